@@ -347,6 +347,25 @@ public:
    */
   void useFECache(bool fe_cache) { _should_use_fe_cache = fe_cache; }
 
+  /**
+   * Limit what the FE shape function cache holds.
+   *
+   * @param memory_budget Number of bytes the cached values may use (0 for no limit).  The least
+   *                      recently used elements are evicted first.
+   * @param blocks Subdomains whose elements are cached (all subdomains if empty)
+   */
+  void setFECacheLimits(std::size_t memory_budget, const std::set<SubdomainID> & blocks);
+
+  ///@{
+  /**
+   * FE shape function cache statistics
+   */
+  unsigned long int feCacheHits() const { return _fe_cache_hits; }
+  unsigned long int feCacheMisses() const { return _fe_cache_misses; }
+  std::size_t feCacheBytes() const { return _fe_cache_bytes; }
+  unsigned int feCacheEntries() const { return _fe_cache_entries; }
+  ///@}
+
   void prepare();
   void prepareNonlocal();
 
@@ -390,6 +409,12 @@ public:
    */
   void cacheResidualNodes(DenseVector<Number> & res, std::vector<dof_id_type> & dof_index);
 
+  /**
+   * Lets an external class cache the residual of an element, which is constrained and scaled
+   * the same way as the contributions cached by cacheResidual()
+   */
+  void cacheResidualBlock(DenseVector<Number> & res_block, std::vector<dof_id_type> & dof_indices, Real scaling_factor, Moose::KernelType type = Moose::KT_NONTIME);
+
   /**
    * Takes the values that are currently in _sub_Ke and appends them to the cached values.
    */
@@ -402,6 +427,30 @@ public:
    */
   void addCachedResidual(NumericVector<Number> & residual, Moose::KernelType type);
 
+  /**
+   * Adds the cached residual entries of locally owned dofs to a process-local buffer
+   * holding one value per owned dof, starting at first_dof.  The remaining entries
+   * stay cached for a later addCachedResidual().  The buffer is written without any
+   * locking, so callers must guarantee that no other thread touches the same dofs.
+   */
+  void addCachedResidualToBuffer(std::vector<Number> & buffer, dof_id_type first_dof, Moose::KernelType type);
+
+  /**
+   * Multiplies the cached Jacobian entries by x and caches the products as non-time
+   * residual contributions, so the next addCachedResidual() adds J*x to a vector.
+   * The cached Jacobian entries are discarded.
+   *
+   * @param x Ghosted vector the Jacobian is applied to
+   */
+  void cacheJacobianAction(const NumericVector<Number> & x);
+
+  /**
+   * Caches the diagonal entries of the cached Jacobian as non-time residual
+   * contributions, so the next addCachedResidual() adds the diagonal of J to a vector.
+   * The cached Jacobian entries are discarded.
+   */
+  void cacheJacobianDiagonal();
+
   void setResidual(NumericVector<Number> & residual, Moose::KernelType type = Moose::KT_NONTIME);
   void setResidualNeighbor(NumericVector<Number> & residual, Moose::KernelType type = Moose::KT_NONTIME);
 
@@ -485,6 +534,11 @@ public:
    */
   void invalidateCache();
 
+  /**
+   * Free all cached FE data.  This has to be called when the element numbering changes.
+   */
+  void clearCache();
+
   std::map<FEType, bool> _need_second_derivative;
 
   /**
@@ -507,6 +561,18 @@ public:
    */
   void addCachedJacobianContributions(SparseMatrix<Number> & jacobian);
 
+  /**
+   * Replaces the rows of y that have cached Jacobian contributions by the action of
+   * those rows on x, i.e. the matrix-free counterpart of setCachedJacobianContributions().
+   */
+  void setCachedJacobianContributionsAction(const NumericVector<Number> & x, NumericVector<Number> & y);
+
+  /**
+   * Replaces the entries of diag whose rows have cached Jacobian contributions by the
+   * diagonal entries of those rows.
+   */
+  void setCachedJacobianContributionsDiagonal(NumericVector<Number> & diag);
+
   /**
    * Set the pointer to the XFEM controller object
    */
@@ -761,14 +827,26 @@ protected:
    * When reinit() is called on an element we will retrieve the ElementFEShapeData class associated with that
    * element.  If it's NULL we'll make one.  Then we'll store a copy of the shape functions computed on that
    * element within shape_data and JxW and q_points within ElementFEShapeData.
+   *
+   * The entries are also linked into a least recently used list so that the cache can be kept
+   * within a memory budget.
    */
   class ElementFEShapeData
   {
   public:
+    ElementFEShapeData(unsigned int cache_index) :
+        _invalidated(true),
+        _bytes(0),
+        _cache_index(cache_index),
+        _lru_prev(NULL),
+        _lru_next(NULL)
+    {
+    }
+
     /// This is where the cached shape functions will be held
     std::map<FEType, FEShapeData *> _shape_data;
 
-    /// Whether or not this data is invalid (needs to be recached) note that there is no constructor so the value is invalid the first time through and must be set.
+    /// Whether or not this data is invalid (needs to be recached)
     bool _invalidated;
 
     /// Cached JxW
@@ -776,10 +854,63 @@ protected:
 
     /// Cached xyz positions of quadrature points
     MooseArray<Point> _q_points;
+
+    /// Approximate number of bytes held by this entry
+    std::size_t _bytes;
+
+    /// Position of this entry in _element_fe_shape_data_cache (and of its element in the active local element range)
+    unsigned int _cache_index;
+
+    ///@{
+    /// Neighbors in the least recently used list
+    ElementFEShapeData * _lru_prev;
+    ElementFEShapeData * _lru_next;
+    ///@}
   };
 
-  /// Cached shape function values stored by element
-  std::map<dof_id_type, ElementFEShapeData * > _element_fe_shape_data_cache;
+  /**
+   * Get the cache entry for an element, creating it if needed.
+   * @return NULL if the element is not cached
+   */
+  ElementFEShapeData * feCacheEntry(const Elem * elem);
+
+  /// Move an entry to the front of the least recently used list
+  void feCacheTouch(ElementFEShapeData * efesd);
+
+  /// Evict least recently used entries until the cache fits its memory budget
+  void feCacheEvict();
+
+  /// Unlink an entry, update the statistics and free it
+  void feCacheErase(ElementFEShapeData * efesd);
+
+  /// Free the memory held by an entry
+  void deleteFECacheEntry(ElementFEShapeData * efesd);
+
+  /// Approximate number of bytes held by an entry
+  std::size_t feCacheEntryBytes(const ElementFEShapeData & efesd) const;
+
+  /// Cached shape function values, indexed by the position of the element in the active local element range
+  std::vector<ElementFEShapeData *> _element_fe_shape_data_cache;
+
+  /// Number of bytes the cache may use (0 for no limit)
+  std::size_t _fe_cache_memory_budget;
+
+  /// Subdomains whose elements are cached (all if empty)
+  std::set<SubdomainID> _fe_cache_blocks;
+
+  ///@{
+  /// Most and least recently used cache entries
+  ElementFEShapeData * _fe_cache_lru_head;
+  ElementFEShapeData * _fe_cache_lru_tail;
+  ///@}
+
+  ///@{
+  /// Cache statistics
+  unsigned long int _fe_cache_hits;
+  unsigned long int _fe_cache_misses;
+  std::size_t _fe_cache_bytes;
+  unsigned int _fe_cache_entries;
+  ///@}
 
   /// Whether or not fe cache should be built at all
   bool _should_use_fe_cache;
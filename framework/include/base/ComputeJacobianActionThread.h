@@ -0,0 +1,56 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef COMPUTEJACOBIANACTIONTHREAD_H
+#define COMPUTEJACOBIANACTIONTHREAD_H
+
+#include "ComputeFullJacobianThread.h"
+
+/**
+ * Computes y = J*x element by element without assembling J.
+ *
+ * The element Jacobians are computed exactly as ComputeFullJacobianThread does,
+ * but instead of being added to the global matrix each cached block is
+ * multiplied by the local entries of x and accumulated into y.  Without x, the
+ * diagonal entries of the blocks are accumulated instead, so y receives the
+ * diagonal of J.
+ */
+class ComputeJacobianActionThread : public ComputeFullJacobianThread
+{
+public:
+  /**
+   * @param fe_problem The problem
+   * @param jacobian The system matrix; it is never written to
+   * @param x Ghosted vector the Jacobian is applied to, NULL to compute the diagonal of J
+   * @param y Vector receiving J*x or the diagonal of J
+   */
+  ComputeJacobianActionThread(FEProblemBase & fe_problem, SparseMatrix<Number> & jacobian,
+                              const NumericVector<Number> * x, NumericVector<Number> & y);
+
+  // Splitting Constructor
+  ComputeJacobianActionThread(ComputeJacobianActionThread & x, Threads::split split);
+
+  virtual ~ComputeJacobianActionThread();
+
+  virtual void postElement(const Elem * elem) override;
+
+  void join(const ComputeJacobianActionThread & /*y*/) {}
+
+protected:
+  const NumericVector<Number> * _x;
+  NumericVector<Number> & _y;
+};
+
+#endif //COMPUTEJACOBIANACTIONTHREAD_H
@@ -27,6 +27,7 @@ class IntegratedBC;
 class DGKernel;
 class InterfaceKernel;
 class KernelWarehouse;
+class ElementCostScheduler;
 
 class ComputeJacobianThread : public ThreadedElementLoop<ConstElemRange>
 {
@@ -54,6 +55,15 @@ protected:
 
   unsigned int _num_cached;
 
+  /// Number of elements cached before the Jacobian is added to the global matrix
+  const unsigned int _batch_size;
+
+  /// How the cached contributions are added to the global Jacobian
+  const Moose::ThreadedAssemblyType _threaded_assembly;
+
+  /// Times the elements so that they can be distributed among threads by cost
+  ElementCostScheduler & _scheduler;
+
   // Reference to BC storage structures
   const MooseObjectWarehouse<IntegratedBC> & _integrated_bcs;
 
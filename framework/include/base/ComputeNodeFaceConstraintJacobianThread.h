@@ -0,0 +1,79 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef COMPUTENODEFACECONSTRAINTJACOBIANTHREAD_H
+#define COMPUTENODEFACECONSTRAINTJACOBIANTHREAD_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/threads.h"
+
+// Forward declarations
+class FEProblemBase;
+class NodeFaceConstraint;
+class PenetrationLocator;
+
+namespace libMesh
+{
+template <typename T> class SparseMatrix;
+}
+
+/**
+ * Computes the Jacobian of the NodeFaceConstraints of a PenetrationLocator on a range of its slave nodes.
+ *
+ * Each thread evaluates its own copies of the constraints and caches the contributions in its own
+ * Assembly.  The caller zeroes the rows in zeroRows() and then adds the caches of all of the threads
+ * to the Jacobian after the loop.
+ */
+class ComputeNodeFaceConstraintJacobianThread
+{
+public:
+  /**
+   * @param constraints The constraints to apply, indexed by thread
+   * @param jacobian The Jacobian being assembled
+   */
+  ComputeNodeFaceConstraintJacobianThread(FEProblemBase & fe_problem,
+                                          PenetrationLocator & penetration_locator,
+                                          const std::vector<std::vector<MooseSharedPointer<NodeFaceConstraint> > > & constraints,
+                                          SparseMatrix<Number> & jacobian);
+
+  // Splitting Constructor
+  ComputeNodeFaceConstraintJacobianThread(ComputeNodeFaceConstraintJacobianThread & x, Threads::split split);
+
+  void operator() (const NodeIdRange & range);
+
+  void join(const ComputeNodeFaceConstraintJacobianThread & y);
+
+  /// Whether a constraint was applied on any of the slave nodes
+  bool constraintsApplied() const { return _constraints_applied; }
+
+  /// The rows of the slave dofs whose Jacobian is overwritten by a constraint
+  const std::vector<numeric_index_type> & zeroRows() const { return _zero_rows; }
+
+protected:
+  FEProblemBase & _fe_problem;
+  PenetrationLocator & _penetration_locator;
+  const std::vector<std::vector<MooseSharedPointer<NodeFaceConstraint> > > & _constraints;
+  SparseMatrix<Number> & _jacobian;
+
+  THREAD_ID _tid;
+
+  bool _constraints_applied;
+  std::vector<numeric_index_type> _zero_rows;
+};
+
+#endif //COMPUTENODEFACECONSTRAINTJACOBIANTHREAD_H
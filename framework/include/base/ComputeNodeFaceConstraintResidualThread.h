@@ -0,0 +1,78 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef COMPUTENODEFACECONSTRAINTRESIDUALTHREAD_H
+#define COMPUTENODEFACECONSTRAINTRESIDUALTHREAD_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/threads.h"
+
+// Forward declarations
+class FEProblemBase;
+class NodeFaceConstraint;
+class PenetrationLocator;
+
+namespace libMesh
+{
+template <typename T> class NumericVector;
+}
+
+/**
+ * Computes the residual of the NodeFaceConstraints of a PenetrationLocator on a range of its slave nodes.
+ *
+ * Each thread evaluates its own copies of the constraints and caches the contributions in its own
+ * Assembly.  The caller adds the caches of all of the threads to the residual after the loop.
+ */
+class ComputeNodeFaceConstraintResidualThread
+{
+public:
+  /**
+   * @param constraints The constraints to apply, indexed by thread
+   * @param residual The residual that constraints overwriting the slave residual insert into
+   */
+  ComputeNodeFaceConstraintResidualThread(FEProblemBase & fe_problem,
+                                          PenetrationLocator & penetration_locator,
+                                          const std::vector<std::vector<MooseSharedPointer<NodeFaceConstraint> > > & constraints,
+                                          NumericVector<Number> & residual);
+
+  // Splitting Constructor
+  ComputeNodeFaceConstraintResidualThread(ComputeNodeFaceConstraintResidualThread & x, Threads::split split);
+
+  void operator() (const NodeIdRange & range);
+
+  void join(const ComputeNodeFaceConstraintResidualThread & y);
+
+  /// Whether a constraint was applied on any of the slave nodes
+  bool constraintsApplied() const { return _constraints_applied; }
+
+  /// Whether a constraint inserted values into the residual
+  bool residualHasInsertedValues() const { return _residual_has_inserted_values; }
+
+protected:
+  FEProblemBase & _fe_problem;
+  PenetrationLocator & _penetration_locator;
+  const std::vector<std::vector<MooseSharedPointer<NodeFaceConstraint> > > & _constraints;
+  NumericVector<Number> & _residual;
+
+  THREAD_ID _tid;
+
+  bool _constraints_applied;
+  bool _residual_has_inserted_values;
+};
+
+#endif //COMPUTENODEFACECONSTRAINTRESIDUALTHREAD_H
@@ -29,6 +29,7 @@ class InterfaceKernel;
 class TimeKernel;
 class KernelBase;
 class KernelWarehouse;
+class ElementCostScheduler;
 
 class ComputeResidualThread : public ThreadedElementLoop<ConstElemRange>
 {
@@ -54,6 +55,15 @@ protected:
   Moose::KernelType _kernel_type;
   unsigned int _num_cached;
 
+  /// Number of elements cached before the residual is added to the global vector
+  const unsigned int _batch_size;
+
+  /// How the cached contributions are added to the global residual
+  const Moose::ThreadedAssemblyType _threaded_assembly;
+
+  /// Times the elements so that they can be distributed among threads by cost
+  ElementCostScheduler & _scheduler;
+
   /// Reference to BC storage structures
   const MooseObjectWarehouse<IntegratedBC> & _integrated_bcs;
 
@@ -69,6 +79,31 @@ protected:
   const MooseObjectWarehouse<KernelBase> & _time_kernels;
   const MooseObjectWarehouse<KernelBase> & _non_time_kernels;
   ///@}
+
+  /// The kernel storage selected by _kernel_type
+  const MooseObjectWarehouse<KernelBase> & _warehouse;
+
+  /// Active kernels on the current subdomain (NULL if there are none), looked up once per subdomain
+  const std::vector<MooseSharedPointer<KernelBase> > * _subdomain_kernels;
+
+  /// Whether or not kernels that support it compute their residual over batches of elements
+  const bool _batch_kernels;
+
+  ///@{
+  /// The active kernels on the current subdomain split into kernels computed per element and per batch
+  std::vector<KernelBase *> _element_kernels;
+  std::vector<KernelBase *> _batched_kernels;
+  ///@}
+
+  /// Number of elements stored by the batched kernels since their last evaluation
+  unsigned int _num_batched;
+
+  /// Evaluate the residual of the elements stored by the batched kernels
+  void computeBatchedResidual();
+
+private:
+  /// Select the kernel storage for the given kernel type
+  const MooseObjectWarehouse<KernelBase> & kernelWarehouse(Moose::KernelType type) const;
 };
 
 #endif //COMPUTERESIDUALTHREAD_H
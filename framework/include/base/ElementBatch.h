@@ -0,0 +1,133 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ELEMENTBATCH_H
+#define ELEMENTBATCH_H
+
+#include "MooseTypes.h"
+#include "MooseArray.h"
+#include "MooseVariableBase.h"
+#include "MaterialProperty.h"
+
+// libMesh includes
+#include "libmesh/dense_vector.h"
+
+// Forward declarations
+class Assembly;
+
+/**
+ * Element data gathered by a kernel over a batch of elements so that its residual
+ * can be evaluated in one pass instead of once per element.
+ *
+ * The data of consecutive elements is stored back to back in flat arrays: the
+ * integration weights (JxW times the coordinate transformation) and the gradient of
+ * the solution per quadrature point, the gradient of the test functions per dof and
+ * quadrature point, and the dof indices and resulting residual per dof.  Elements
+ * of different types may share a batch; the offsets of each element are stored
+ * alongside its data.
+ */
+class ElementBatch
+{
+public:
+  ElementBatch();
+
+  /**
+   * Append the data of the current element to the batch
+   * @param dof_indices The dof indices of the variable on the element
+   * @param JxW The quadrature weights times the Jacobian of the mapping
+   * @param coord The coordinate transformation factors
+   * @param grad_test The gradient of the test functions, indexed by [i][qp]
+   * @param grad_u The gradient of the solution, indexed by [qp]
+   */
+  void addElement(const std::vector<dof_id_type> & dof_indices,
+                  const MooseArray<Real> & JxW,
+                  const MooseArray<Real> & coord,
+                  const VariableTestGradient & grad_test,
+                  const VariableGradient & grad_u);
+
+  /**
+   * Multiply the integration weights of the last element that was added by a
+   * coefficient given at each quadrature point
+   */
+  void scaleWeights(const MaterialProperty<Real> & coefficient);
+
+  /**
+   * Cache the residual of every element in the batch in the Assembly object and
+   * empty the batch
+   * @param assembly The Assembly object the kernel contributes to
+   * @param scaling_factor The scaling factor of the kernel's variable
+   */
+  void cacheResidual(Assembly & assembly, Real scaling_factor);
+
+  /// Remove all elements from the batch
+  void clear();
+
+  /// The number of elements in the batch
+  unsigned int size() const { return _dof_offsets.size() - 1; }
+
+  /// Whether or not the batch holds any elements
+  bool empty() const { return size() == 0; }
+
+  ///@{
+  /// The offsets of element e into the per dof and per quadrature point arrays
+  std::size_t dofOffset(unsigned int e) const { return _dof_offsets[e]; }
+  std::size_t qpOffset(unsigned int e) const { return _qp_offsets[e]; }
+  std::size_t gradTestOffset(unsigned int e) const { return _grad_test_offsets[e]; }
+  ///@}
+
+  ///@{
+  /// The number of dofs and quadrature points of element e
+  unsigned int nDofs(unsigned int e) const { return _dof_offsets[e + 1] - _dof_offsets[e]; }
+  unsigned int nQPoints(unsigned int e) const { return _qp_offsets[e + 1] - _qp_offsets[e]; }
+  ///@}
+
+  ///@{
+  /// The flat data arrays of the batch
+  const std::vector<Real> & weights() const { return _weights; }
+  const std::vector<RealGradient> & gradU() const { return _grad_u; }
+  const std::vector<RealGradient> & gradTest() const { return _grad_test; }
+  std::vector<Real> & residual() { return _residual; }
+  ///@}
+
+protected:
+  /// Offsets into the per dof arrays, one entry more than there are elements
+  std::vector<std::size_t> _dof_offsets;
+
+  /// Offsets into the per quadrature point arrays, one entry more than there are elements
+  std::vector<std::size_t> _qp_offsets;
+
+  /// Offsets into the test function gradients, one entry more than there are elements
+  std::vector<std::size_t> _grad_test_offsets;
+
+  /// Dof indices of each element
+  std::vector<dof_id_type> _dof_indices;
+
+  /// Integration weights at each quadrature point
+  std::vector<Real> _weights;
+
+  /// Gradient of the solution at each quadrature point
+  std::vector<RealGradient> _grad_u;
+
+  /// Gradient of the test functions, stored per element as [i][qp]
+  std::vector<RealGradient> _grad_test;
+
+  /// Residual of each dof
+  std::vector<Real> _residual;
+
+  /// Work vectors handed to the Assembly object
+  DenseVector<Number> _element_residual;
+  std::vector<dof_id_type> _element_dof_indices;
+};
+
+#endif /* ELEMENTBATCH_H */
@@ -0,0 +1,140 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ELEMENTCOSTSCHEDULER_H
+#define ELEMENTCOSTSCHEDULER_H
+
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/elem_range.h"
+
+#include <chrono>
+#include <memory>
+#include <unordered_map>
+
+// Forward declarations
+class MooseMesh;
+
+/**
+ * Distributes the active local elements among threads according to the time
+ * spent on each element during the previous residual/Jacobian evaluation.
+ *
+ * The threading backends split a ConstElemRange into chunks holding the same
+ * number of elements, which leaves threads working on expensive elements (e.g.
+ * plasticity with many return-map iterations) behind the others. When enabled,
+ * this object times every element visited by the residual and Jacobian loops
+ * and, once the measured thread imbalance exceeds a tolerance, reorders the
+ * range so that each equal-count chunk carries roughly the same cost.
+ */
+class ElementCostScheduler
+{
+public:
+  ElementCostScheduler(MooseMesh & mesh);
+
+  /**
+   * Turn cost based scheduling on or off
+   * @param enabled Whether or not elements are timed and the range is rebalanced
+   * @param tolerance Relative imbalance (max/average - 1) above which the range is rebuilt
+   */
+  void enable(bool enabled, Real tolerance = 0.1);
+
+  /**
+   * Whether or not cost based scheduling is in use
+   */
+  bool enabled() const { return _enabled; }
+
+  /**
+   * The range the residual and Jacobian loops should iterate over. This is the
+   * cost balanced range once one has been built, otherwise the mesh's active
+   * local element range.
+   */
+  ConstElemRange & elementRange();
+
+  /**
+   * Start timing the element about to be computed on thread tid
+   */
+  void startElement(THREAD_ID tid)
+  {
+    if (_enabled)
+      _start[tid] = std::chrono::steady_clock::now();
+  }
+
+  /**
+   * Stop timing the current element on thread tid and record its cost
+   */
+  void stopElement(const Elem * elem, THREAD_ID tid)
+  {
+    if (_enabled)
+      _samples[tid].emplace_back(elem, std::chrono::duration<Real>(std::chrono::steady_clock::now() - _start[tid]).count());
+  }
+
+  /**
+   * Called after a threaded loop completes: collects the per-thread timings and
+   * rebuilds the balanced range if the threads were out of balance.
+   */
+  void rebalance();
+
+  /**
+   * Discard the element costs and the balanced range (called when the mesh changes)
+   */
+  void meshChanged();
+
+  /**
+   * Time (in seconds) spent by each thread on elements during the last timed loop
+   */
+  const std::vector<Real> & threadTimes() const { return _thread_times; }
+
+  /**
+   * Relative imbalance of the last timed loop: max thread time / average thread time - 1
+   */
+  Real imbalance() const;
+
+  /**
+   * Number of times the balanced range has been rebuilt
+   */
+  unsigned int numRebuilds() const { return _num_rebuilds; }
+
+protected:
+  /// Reorder the active local elements into cost balanced chunks
+  void buildRange();
+
+  MooseMesh & _mesh;
+
+  /// Whether or not scheduling by cost is active
+  bool _enabled;
+
+  /// Imbalance above which the range is rebuilt
+  Real _tolerance;
+
+  /// Start time of the element currently being computed on each thread
+  std::vector<std::chrono::steady_clock::time_point> _start;
+
+  /// (element, seconds) pairs recorded by each thread since the last rebalance()
+  std::vector<std::vector<std::pair<const Elem *, Real> > > _samples;
+
+  /// Most recent cost of every timed element keyed by id
+  std::unordered_map<dof_id_type, Real> _elem_costs;
+
+  /// Time spent by each thread during the last timed loop
+  std::vector<Real> _thread_times;
+
+  /// The cost balanced element range (NULL until one is needed)
+  std::unique_ptr<ConstElemRange> _balanced_range;
+
+  /// Number of times the balanced range has been rebuilt
+  unsigned int _num_rebuilds;
+};
+
+#endif // ELEMENTCOSTSCHEDULER_H
@@ -498,11 +498,19 @@ public:
 
   /**
    * Add the MooseVariables that the current materials depend on to the dependency list.
+   * When a set of needed material properties has been recorded, this also selects the
+   * materials of the subdomain that have to be computed.
    *
    * This MUST be done after the dependency list has been set for all the other objects!
    */
   virtual void prepareMaterials(SubdomainID blk_id, THREAD_ID tid);
 
+  /**
+   * Whether or not the current loop needs the material property with the given id on a subdomain.
+   * This is true for every property unless the objects of the loop recorded the properties they consume.
+   */
+  bool isMaterialPropertyNeeded(unsigned int prop_id, SubdomainID blk_id, THREAD_ID tid);
+
   virtual void reinitMaterials(SubdomainID blk_id, THREAD_ID tid, bool swap_stateful = true);
   virtual void reinitMaterialsFace(SubdomainID blk_id, THREAD_ID tid, bool swap_stateful = true);
   virtual void reinitMaterialsNeighbor(SubdomainID blk_id, THREAD_ID tid, bool swap_stateful = true);
@@ -999,6 +1007,22 @@ public:
 
   void setErrorOnJacobianNonzeroReallocation(bool state) { _error_on_jacobian_nonzero_reallocation = state; }
 
+  /**
+   * Number of elements whose residual/Jacobian contributions each thread caches before
+   * they are added to the global vector or matrix in one call
+   */
+  unsigned int assemblyBatchSize() const { return _assembly_batch_size; }
+
+  /**
+   * How threads add their element contributions to the global residual and Jacobian
+   */
+  Moose::ThreadedAssemblyType threadedAssembly() const { return _threaded_assembly; }
+
+  /**
+   * Whether or not kernels that support it compute their residual over batches of elements
+   */
+  bool batchKernels() const { return _batch_kernels; }
+
   /// Returns whether or not this Problem has a TimeIntegrator
   bool hasTimeIntegrator() const { return _has_time_integrator; }
 
@@ -1136,6 +1160,27 @@ protected:
   MaterialWarehouse _all_materials; // All materials for error checking and MaterialData storage
   ///@}
 
+  ///@{
+  /// Volume and face materials of the prepared subdomain needed by the current loop (THREAD_ID on outer vector)
+  std::vector<std::vector<MooseSharedPointer<Material> > > _needed_materials;
+  std::vector<std::vector<MooseSharedPointer<Material> > > _needed_face_materials;
+  ///@}
+
+  /// The subdomain the needed materials were selected for
+  std::vector<SubdomainID> _needed_materials_block;
+
+  /// Ids of the properties needed by the current loop and by its needed materials (THREAD_ID on outer vector)
+  std::vector<std::set<unsigned int> > _needed_material_properties;
+
+  /**
+   * Select from a dependency sorted list the materials that supply the needed properties,
+   * either directly or through the properties of other selected materials. The properties
+   * the selected materials depend on are added to needed_mat_props.
+   */
+  static void selectNeededMaterials(const std::vector<MooseSharedPointer<Material> > & materials,
+                                    std::set<unsigned int> & needed_mat_props,
+                                    std::vector<MooseSharedPointer<Material> > & needed);
+
   ///@{
   // Indicator Warehouses
   MooseObjectWarehouse<Indicator> _indicators;
@@ -1299,6 +1344,9 @@ private:
 
   bool _error_on_jacobian_nonzero_reallocation;
   bool _force_restart;
+  const unsigned int _assembly_batch_size;
+  const Moose::ThreadedAssemblyType _threaded_assembly;
+  const bool _batch_kernels;
   bool _fail_next_linear_convergence_check;
 
   /// Whether or not the system is currently computing the Jacobian matrix
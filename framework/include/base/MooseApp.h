@@ -403,8 +403,10 @@ public:
   /**
    * Create a Backup from the current App.  A Backup contains all the data necessary to be able
    * to restore the state of an App.
+   *
+   * @param backup An existing Backup to overwrite, its buffers are reused.  A new Backup is created if this is NULL.
    */
-  MooseSharedPointer<Backup> backup();
+  MooseSharedPointer<Backup> backup(MooseSharedPointer<Backup> backup = MooseSharedPointer<Backup>());
 
   /**
    * Restore a Backup.  This sets the App's state.
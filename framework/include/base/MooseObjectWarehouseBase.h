@@ -115,6 +115,24 @@ public:
   void updateBoundaryVariableDependency(BoundaryID id, std::set<MooseVariable *> & needed_moose_vars, THREAD_ID tid = 0) const;
   ///@}
 
+  ///@{
+  /**
+   * Update material property dependency vector.
+   */
+  void updateMatPropDependency(std::set<unsigned int> & needed_mat_props, THREAD_ID tid = 0) const;
+  void updateBlockMatPropDependency(SubdomainID id, std::set<unsigned int> & needed_mat_props, THREAD_ID tid = 0) const;
+  void updateBoundaryMatPropDependency(std::set<unsigned int> & needed_mat_props, THREAD_ID tid = 0) const;
+  void updateBoundaryMatPropDependency(BoundaryID id, std::set<unsigned int> & needed_mat_props, THREAD_ID tid = 0) const;
+  ///@}
+
+  ///@{
+  /**
+   * Update material property dependency vector with the properties only needed for the Jacobian.
+   */
+  void updateBlockJacobianMatPropDependency(SubdomainID id, std::set<unsigned int> & needed_mat_props, THREAD_ID tid = 0) const;
+  void updateBoundaryJacobianMatPropDependency(std::set<unsigned int> & needed_mat_props, THREAD_ID tid = 0) const;
+  ///@}
+
   /**
    * Populates a set of covered subdomains and the associated variable names.
    */
@@ -160,6 +178,13 @@ protected:
   static void updateVariableDependencyHelper(std::set<MooseVariable *> & needed_moose_vars,
                                              const std::vector<MooseSharedPointer<T> > & objects);
 
+  /**
+   * Helper method for updating material property dependency vector
+   */
+  static void updateMatPropDependencyHelper(std::set<unsigned int> & needed_mat_props,
+                                            const std::vector<MooseSharedPointer<T> > & objects,
+                                            bool jacobian = false);
+
   /**
    * Calls assert on thread id.
    */
@@ -540,6 +565,82 @@ MooseObjectWarehouseBase<T>::updateVariableDependencyHelper(std::set<MooseVariab
 }
 
 
+template<typename T>
+void
+MooseObjectWarehouseBase<T>::updateMatPropDependency(std::set<unsigned int> & needed_mat_props, THREAD_ID tid/* = 0*/) const
+{
+  if (hasActiveObjects(tid))
+    updateMatPropDependencyHelper(needed_mat_props, _all_objects[tid]);
+}
+
+
+template<typename T>
+void
+MooseObjectWarehouseBase<T>::updateBlockMatPropDependency(SubdomainID id, std::set<unsigned int> & needed_mat_props, THREAD_ID tid/* = 0*/) const
+{
+  if (hasActiveBlockObjects(id, tid))
+    updateMatPropDependencyHelper(needed_mat_props, getActiveBlockObjects(id, tid));
+}
+
+
+template<typename T>
+void
+MooseObjectWarehouseBase<T>::updateBoundaryMatPropDependency(std::set<unsigned int> & needed_mat_props, THREAD_ID tid/* = 0*/) const
+{
+  if (hasActiveBoundaryObjects(tid))
+  {
+    typename std::map<BoundaryID, std::vector<MooseSharedPointer<T> > >::const_iterator it;
+    for (it = _active_boundary_objects[tid].begin(); it != _active_boundary_objects[tid].end(); ++it)
+      updateMatPropDependencyHelper(needed_mat_props, it->second);
+  }
+}
+
+
+template<typename T>
+void
+MooseObjectWarehouseBase<T>::updateBoundaryMatPropDependency(BoundaryID id, std::set<unsigned int> & needed_mat_props, THREAD_ID tid/* = 0*/) const
+{
+  if (hasActiveBoundaryObjects(id, tid))
+    updateMatPropDependencyHelper(needed_mat_props, getActiveBoundaryObjects(id, tid));
+}
+
+
+template<typename T>
+void
+MooseObjectWarehouseBase<T>::updateBlockJacobianMatPropDependency(SubdomainID id, std::set<unsigned int> & needed_mat_props, THREAD_ID tid/* = 0*/) const
+{
+  if (hasActiveBlockObjects(id, tid))
+    updateMatPropDependencyHelper(needed_mat_props, getActiveBlockObjects(id, tid), true);
+}
+
+
+template<typename T>
+void
+MooseObjectWarehouseBase<T>::updateBoundaryJacobianMatPropDependency(std::set<unsigned int> & needed_mat_props, THREAD_ID tid/* = 0*/) const
+{
+  if (hasActiveBoundaryObjects(tid))
+  {
+    typename std::map<BoundaryID, std::vector<MooseSharedPointer<T> > >::const_iterator it;
+    for (it = _active_boundary_objects[tid].begin(); it != _active_boundary_objects[tid].end(); ++it)
+      updateMatPropDependencyHelper(needed_mat_props, it->second, true);
+  }
+}
+
+
+template<typename T>
+void
+MooseObjectWarehouseBase<T>::updateMatPropDependencyHelper(std::set<unsigned int> & needed_mat_props,
+                                                          const std::vector<MooseSharedPointer<T> > & objects,
+                                                          bool jacobian)
+{
+  for (const auto & object : objects)
+  {
+    const std::set<unsigned int> & mp_deps = jacobian ? object->getJacobianMatPropDependencies() : object->getMatPropDependencies();
+    needed_mat_props.insert(mp_deps.begin(), mp_deps.end());
+  }
+}
+
+
 template<typename T>
 void
 MooseObjectWarehouseBase<T>::subdomainsCovered(std::set<SubdomainID> & subdomains_covered, std::set<std::string> & unique_variables, THREAD_ID tid/*=0*/) const
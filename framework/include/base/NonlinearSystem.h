@@ -44,6 +44,14 @@ public:
 
   virtual void setupFiniteDifferencedPreconditioner() override;
 
+  /**
+   * Replaces the Jacobian operator seen by the Krylov solver with a PETSc shell
+   * matrix that applies the analytic Jacobian element by element (solve_type = MATRIX_FREE).
+   * No matrix is assembled: the shell matrix also provides the diagonal of the Jacobian,
+   * which is all the default Jacobi preconditioner needs.
+   */
+  void setupMatrixFreeJacobian();
+
   /**
    * Returns the convergence state
    * @return true if converged, otherwise false
@@ -62,6 +70,11 @@ public:
 
 protected:
   TransientNonlinearImplicitSystem & _transient_sys;
+
+#ifdef LIBMESH_HAVE_PETSC
+  /// Shell matrix applying the Jacobian without storing it (MATRIX_FREE only)
+  Mat _jacobian_action;
+#endif
 };
 
 #endif /* NONLINEARSYSTEM_H */
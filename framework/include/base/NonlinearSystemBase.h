@@ -19,6 +19,7 @@
 #include "KernelWarehouse.h"
 #include "ConstraintWarehouse.h"
 #include "MooseObjectWarehouse.h"
+#include "ElementCostScheduler.h"
 
 // libMesh includes
 #include "libmesh/transient_system.h"
@@ -208,6 +209,15 @@ public:
    */
   void constraintResiduals(NumericVector<Number> & residual, bool displaced);
 
+  /**
+   * Collect the copies for each thread of NodeFaceConstraints (see NodeFaceConstraint::supportsThreadedAssembly())
+   * @param constraints The constraints of a slave boundary
+   * @param threaded_constraints The copies, indexed by thread
+   * @return Whether the slave nodes of the constraints can be assembled by several threads
+   */
+  bool getThreadedNodeFaceConstraints(const std::vector<MooseSharedPointer<NodeFaceConstraint> > & constraints,
+                                      std::vector<std::vector<MooseSharedPointer<NodeFaceConstraint> > > & threaded_constraints) const;
+
   /**
    * Computes residual
    * @param residual Residual is formed in here
@@ -245,6 +255,21 @@ public:
    */
   void computeJacobian(SparseMatrix<Number> &  jacobian);
 
+  /**
+   * Applies the Jacobian to a vector element by element without assembling it.
+   * Used by the MATRIX_FREE solve type.
+   * @param x The vector the Jacobian is applied to
+   * @param y Receives J*x
+   */
+  void computeJacobianAction(const NumericVector<Number> & x, NumericVector<Number> & y);
+
+  /**
+   * Computes the diagonal of the Jacobian element by element without assembling it.
+   * Used to precondition the MATRIX_FREE solve type.
+   * @param diag Receives the diagonal of J
+   */
+  void computeJacobianDiagonal(NumericVector<Number> & diag);
+
   /**
    * Computes several Jacobian blocks simultaneously, summing their contributions into smaller preconditioning matrices.
    *
@@ -471,6 +496,29 @@ public:
 
   virtual System & system() override { return _sys; }
 
+  /**
+   * The scheduler distributing elements among threads for the residual and Jacobian loops
+   */
+  ElementCostScheduler & elementScheduler() { return _element_scheduler; }
+
+  /**
+   * Add the locally owned residual entries cached on thread tid to the colored assembly
+   * buffers.  Only valid while the threads are working on elements of a single color.
+   */
+  void addCachedResidualColored(THREAD_ID tid);
+
+  /**
+   * Assemble the Jacobian contributions of the elements in these subdomains once and
+   * add the stored result to every later Jacobian instead of recomputing them.
+   * Must be called before the equation systems are initialized.
+   */
+  void setConstantJacobianBlocks(const std::set<SubdomainID> & blocks);
+
+  /**
+   * Throw away the stored constant Jacobian and the element ranges (called when the mesh changes)
+   */
+  void resetConstantJacobian();
+
 public:
   FEProblemBase & _fe_problem;
   System & _sys;
@@ -499,10 +547,54 @@ protected:
 
   void computeJacobianInternal(SparseMatrix<Number> &  jacobian);
 
+  /**
+   * Computes the NodalBC Jacobian rows on thread 0 and caches them in its Assembly
+   * as Jacobian contributions
+   */
+  void cacheNodalBCJacobians();
+
+  /**
+   * Element loop shared by computeJacobianAction() and computeJacobianDiagonal()
+   * @param x Ghosted vector the Jacobian is applied to, NULL to compute the diagonal
+   * @param y Receives J*x or the diagonal of J
+   */
+  void computeJacobianActionInternal(const NumericVector<Number> * x, NumericVector<Number> & y);
+
+  /**
+   * Run the element loop of the Jacobian evaluation with the given thread object,
+   * either one color at a time or over the whole (scheduled) element range
+   */
+  template <typename T>
+  void computeElementJacobians(T & cj, SparseMatrix<Number> & jacobian);
+
   void computeDiracContributions(SparseMatrix<Number> * jacobian = NULL);
 
   void computeScalarKernelsJacobians(SparseMatrix<Number> & jacobian);
 
+  /**
+   * Set up the element ranges of the constant Jacobian blocks and reassemble the stored constant
+   * Jacobian if the time step changed.  The stored matrix is dropped if its nonzero pattern
+   * doesn't match the one of jacobian anymore, the constant blocks are then assembled with the
+   * rest of the elements.
+   */
+  void prepareConstantJacobian(SparseMatrix<Number> & jacobian);
+
+  /**
+   * Add the stored constant Jacobian to the closed jacobian, or store the constant Jacobian
+   * with the nonzero pattern of jacobian when it was assembled along with the other elements
+   */
+  void addConstantJacobian(SparseMatrix<Number> & jacobian);
+
+  /**
+   * Assemble the contributions of the elements in the constant Jacobian blocks into the stored matrix
+   */
+  void assembleConstantJacobian();
+
+  /**
+   * Whether the stored constant Jacobian has the nonzero pattern of jacobian
+   */
+  bool constantJacobianMatches(SparseMatrix<Number> & jacobian);
+
   /**
    * Enforce nodal constraints
    */
@@ -573,6 +665,9 @@ protected:
   /// Constraints storage object
   ConstraintWarehouse _constraints;
 
+  /// The copies for each thread of the NodeFaceConstraints that support threaded assembly, by their thread 0 copy in _constraints
+  std::map<const NodeFaceConstraint *, std::vector<MooseSharedPointer<NodeFaceConstraint> > > _threaded_node_face_constraints;
+
 
 protected:
   /// increment vector
@@ -645,6 +740,41 @@ protected:
   /// If there is a nodal BC having diag_save_in
   bool _has_nodalbc_diag_save_in;
 
+  /// Cost based distribution of the elements among threads
+  ElementCostScheduler _element_scheduler;
+
+  /// Process-local time and non-time residual accumulators used by the colored threaded assembly
+  std::vector<Number> _colored_residual[2];
+
+  /// The dofs owned by this processor, in the order of the colored residual accumulators
+  std::vector<dof_id_type> _colored_residual_dofs;
+
+  /// Subdomains whose Jacobian contributions are assembled once and reused
+  std::set<SubdomainID> _constant_jacobian_blocks;
+
+#ifdef LIBMESH_HAVE_PETSC
+  /// Stored Jacobian of the constant blocks, it has the nonzero pattern of the system matrix (NULL until it is created)
+  Mat _constant_jacobian;
+#endif
+
+  /// Whether or not _constant_jacobian holds the current contributions
+  bool _constant_jacobian_assembled;
+
+  /// Time derivative coefficient the constant Jacobian was assembled with
+  Number _constant_jacobian_du_dot_du;
+
+  ///@{
+  /// Local elements in the constant Jacobian blocks and the others, the ranges below iterate over them
+  std::vector<Elem *> _constant_jacobian_elems;
+  std::vector<Elem *> _varying_jacobian_elems;
+  ///@}
+
+  /// Local elements in the constant Jacobian blocks
+  std::unique_ptr<ConstElemRange> _constant_jacobian_range;
+
+  /// Local elements whose Jacobian is reassembled every time
+  std::unique_ptr<ConstElemRange> _varying_jacobian_range;
+
   void getNodeDofs(unsigned int node_id, std::vector<dof_id_type> & dofs);
 
   std::vector<dof_id_type> _var_all_dof_indices;
@@ -111,6 +111,38 @@ public:
    */
   virtual void clearActiveElementalMooseVariables(THREAD_ID tid);
 
+  /**
+   * Record the set of material properties needed by the objects of the current loop.
+   * Only the materials supplying these properties (and the properties they depend on)
+   * are computed until clearActiveMaterialProperties() is called.
+   *
+   * @param mat_prop_ids The ids of the needed material properties
+   * @param tid The thread id
+   */
+  virtual void setActiveMaterialProperties(const std::set<unsigned int> & mat_prop_ids, THREAD_ID tid);
+
+  /**
+   * Get the material properties needed by the objects of the current loop.
+   *
+   * @param tid The thread id
+   */
+  virtual const std::set<unsigned int> & getActiveMaterialProperties(THREAD_ID tid);
+
+  /**
+   * Whether or not a set of needed material properties has been recorded.
+   *
+   * @return True if the materials are restricted to the needed ones, False if all of them are computed
+   */
+  virtual bool hasActiveMaterialProperties(THREAD_ID tid);
+
+  /**
+   * Clear the needed material properties so that all materials are computed again.
+   * Call this after finishing the computation that set them.
+   *
+   * @param tid The thread id
+   */
+  virtual void clearActiveMaterialProperties(THREAD_ID tid);
+
   virtual Assembly & assembly(THREAD_ID tid) = 0;
   virtual void prepareShapes(unsigned int var, THREAD_ID tid) = 0;
   virtual void prepareFaceShapes(unsigned int var, THREAD_ID tid) = 0;
@@ -368,6 +400,13 @@ protected:
   /* This needs to remain <unsigned int> for threading purposes */
   std::vector<unsigned int> _has_active_elemental_moose_variables;
 
+  /// The ids of the material properties needed by the objects of the current loop
+  std::vector<std::set<unsigned int> > _active_material_property_ids;
+
+  /// Whether or not there is currently a set of needed material properties
+  /* This needs to remain <unsigned int> for threading purposes */
+  std::vector<unsigned int> _has_active_material_properties;
+
   /// nonlocal coupling requirement flag
   bool _requires_nonlocal_coupling;
 
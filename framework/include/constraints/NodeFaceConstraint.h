@@ -80,6 +80,17 @@ public:
    */
   virtual bool shouldApply() { return true; }
 
+  /**
+   * Whether the slave nodes of this constraint can be assembled by several threads.
+   *
+   * If so a copy of the constraint is built for each thread.  Only the copy of thread 0 gets the
+   * setup calls (timestepSetup(), jacobianSetup(), ...), and a slave node may be assembled by
+   * any of the copies, so the per-node state must live in data shared by all of them
+   * (e.g. the PenetrationInfo).  While it is assembled the constraint may read ghosted vectors,
+   * but must not read the Jacobian matrix (_jacobian) or write to any global vector or matrix.
+   */
+  virtual bool supportsThreadedAssembly() const { return false; }
+
   /**
    * Whether or not the slave's residual should be overwritten.
    *
@@ -71,6 +71,10 @@ public:
 
   virtual ~DGKernel();
 
+  /// The material properties this kernel depends on (used to select the materials to compute)
+  using TwoMaterialPropertyInterface::getMatPropDependencies;
+  using TwoMaterialPropertyInterface::getJacobianMatPropDependencies;
+
   /**
    * The variable number that this kernel operates on.
    */
@@ -82,6 +82,12 @@ public:
    */
   Real maxPatchPercentage();
 
+  /**
+   * Rebuild the patches of the slave nodes that are close to leaving them in all of the NearestNodeLocators.
+   * @return Whether or not new elements were ghosted on this processor
+   */
+  bool updatePatches();
+
 //protected:
   SubProblem & _subproblem;
   MooseMesh & _mesh;
@@ -43,6 +43,15 @@ public:
    */
   void reinit();
 
+  /**
+   * Rebuild the patches of the slave nodes whose nearest node was found far into
+   * their patch (see _patch_rebuild_percentage) from the current nodal positions.
+   * Elements newly needed by the rebuilt patches are added to the ghosted elements
+   * of the SubProblem.
+   * @return Whether or not new elements were ghosted
+   */
+  bool updatePatches();
+
   /**
    * Valid to call this after findNodes() has been called to get the distance to the nearest node.
    */
@@ -74,6 +83,9 @@ public:
 
     const Node * _nearest_node;
     Real _distance;
+
+    /// How far through the patch the nearest node was found
+    Real _patch_percentage;
   };
 
 protected:
@@ -83,6 +95,9 @@ protected:
 
   NodeIdRange * _slave_node_range;
 
+  /// The master nodes the patches are built from (only valid after the first findNodes())
+  std::vector<dof_id_type> _trial_master_nodes;
+
 public:
   std::map<dof_id_type, NearestNodeInfo> _nearest_node_info;
 
@@ -99,6 +114,12 @@ public:
 
   // The furthest through the patch that had to be searched for any node last time
   Real _max_patch_percentage;
+
+  // Whether updatePatches() ghosted new elements during findNodes() since this was last reset
+  bool _ghosting_changed;
+
+  // Slave nodes whose nearest node is at least this far through their patch get a new patch in updatePatches()
+  static const Real _patch_rebuild_percentage;
 };
 
 #endif //NEARESTNODELOCATOR_H
@@ -0,0 +1,88 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef PENETRATIONINFOSTORAGE_H
+#define PENETRATIONINFOSTORAGE_H
+
+// MOOSE includes
+#include "PenetrationInfo.h"
+
+// C++ includes
+#include <deque>
+#include <map>
+#include <unordered_map>
+
+/**
+ * Storage for the PenetrationInfo objects of a PenetrationLocator, indexed by slave node.
+ *
+ * Each slave node gets a fixed slot the first time it is searched for and keeps it until clear() is called.
+ * The slots live in a std::deque, which allocates them in blocks that never move (they are not one
+ * contiguous array).  PenetrationInfo copies share their side element, so the slots can't be moved
+ * the way a growing std::vector would, and the pointers in infoMap() stay valid while the storage grows.
+ * A slot is reused (rather than freed and reallocated) when its node moves in and out of contact over
+ * the timesteps.
+ */
+class PenetrationInfoStorage
+{
+public:
+  PenetrationInfoStorage();
+
+  /// The PenetrationInfo of each slave node (NULL while the node has no contact candidate), pointing into the slots
+  std::map<dof_id_type, PenetrationInfo *> & infoMap() { return _info_map; }
+
+  /**
+   * Give a slot to the slave node if it doesn't have one yet.
+   * The slots are shared by the threads, so this must be called before the threaded search.
+   */
+  void reserve(dof_id_type node_id);
+
+  /**
+   * Copy info into the slot of its slave node and return the slot.
+   * The slot takes over the side element of info.  Only the slot of info's node is touched, so threads
+   * can store the infos of different nodes concurrently.
+   */
+  PenetrationInfo * store(PenetrationInfo & info);
+
+  /// Reset the slot info points to and set info to NULL.  The node keeps its slot.
+  void release(PenetrationInfo * & info);
+
+  /// Release every slot and forget the slave nodes (e.g. after the mesh changed).  The slots are kept for reuse.
+  void clear();
+
+  /// The number of slave nodes that have a slot
+  unsigned int numSlaveNodes() const { return _n_used; }
+
+protected:
+  /// The slots, in the order the slave nodes were reserved
+  std::deque<PenetrationInfo> _slots;
+
+  /// The slot index of each slave node
+  std::unordered_map<dof_id_type, unsigned int> _slot_index;
+
+  /// The number of slots in use, slots past this are left over from before the last clear()
+  unsigned int _n_used;
+
+  /// See infoMap()
+  std::map<dof_id_type, PenetrationInfo *> _info_map;
+};
+
+/**
+ * The storage is written as one block per member: the slave nodes first and then every member
+ * of their PenetrationInfo for all of the nodes at once.  It is also read from the
+ * std::map<dof_id_type, PenetrationInfo *> that older checkpoints contain under the same name.
+ */
+template<> void dataStore(std::ostream & stream, PenetrationInfoStorage & storage, void * context);
+template<> void dataLoad(std::istream & stream, PenetrationInfoStorage & storage, void * context);
+
+#endif //PENETRATIONINFOSTORAGE_H
@@ -17,7 +17,7 @@
 
 // Moose includes
 #include "Restartable.h"
-#include "PenetrationInfo.h"
+#include "PenetrationInfoStorage.h"
 
 // libmesh includes
 #include "libmesh/vector_value.h"
@@ -70,6 +70,9 @@ public:
 
   NearestNodeLocator & _nearest_node;
 
+  /// Owns the PenetrationInfo objects, use release() on it rather than deleting an entry of _penetration_info
+  PenetrationInfoStorage & _penetration_info_storage;
+
   /// Data structure of nodes and their associated penetration information
   std::map<dof_id_type, PenetrationInfo *> & _penetration_info;
 
@@ -90,6 +93,12 @@ protected:
   bool _do_normal_smoothing;  // Should we do contact normal smoothing?
   Real _normal_smoothing_distance; // Distance from edge (in parametric coords) within which to perform normal smoothing
   NORMAL_SMOOTHING_METHOD _normal_smoothing_method;
+
+  /// Collect the sides of the elements on the master boundary into _master_elem_sides
+  void buildMasterElemSides();
+
+  /// The sides on the master boundary of each element that has any (rebuilt by reinit())
+  std::map<dof_id_type, std::vector<unsigned int> > _master_elem_sides;
 };
 
 /**
@@ -30,7 +30,7 @@ public:
                     const MooseMesh & mesh,
                     BoundaryID master_boundary,
                     BoundaryID slave_boundary,
-                    std::map<dof_id_type, PenetrationInfo *> & penetration_info,
+                    PenetrationInfoStorage & penetration_info_storage,
                     bool check_whether_reasonable,
                     bool update_location,
                     Real tangential_tolerance,
@@ -41,9 +41,7 @@ public:
                     FEType & fe_type,
                     NearestNodeLocator & nearest_node,
                     const std::map<dof_id_type, std::vector<dof_id_type> > & node_to_elem_map,
-                    std::vector<dof_id_type> & elem_list,
-                    std::vector<unsigned short int> & side_list,
-                    std::vector<boundary_id_type> & id_list);
+                    const std::map<dof_id_type, std::vector<unsigned int> > & master_elem_sides);
 
   // Splitting Constructor
   PenetrationThread(PenetrationThread & x, Threads::split split);
@@ -59,6 +57,9 @@ protected:
   BoundaryID _master_boundary;
   BoundaryID _slave_boundary;
 
+  // The storage of the PenetrationInfo objects of the slave nodes
+  PenetrationInfoStorage & _penetration_info_storage;
+
   // This is the info map we're actually filling here
   std::map<dof_id_type, PenetrationInfo *> & _penetration_info;
 
@@ -80,11 +81,8 @@ protected:
 
   const std::map<dof_id_type, std::vector<dof_id_type> > & _node_to_elem_map;
 
-  std::vector<dof_id_type> & _elem_list;
-  std::vector<unsigned short int> & _side_list;
-  std::vector<boundary_id_type> & _id_list;
-
-  unsigned int _n_elems;
+  /// The sides of each element that are on the master boundary
+  const std::map<dof_id_type, std::vector<unsigned int> > & _master_elem_sides;
 
   THREAD_ID _tid;
 
@@ -20,6 +20,7 @@
 
 // Forward declarations
 class MooseMesh;
+class KDTree;
 
 class SlaveNeighborhoodThread
 {
@@ -27,7 +28,8 @@ public:
   SlaveNeighborhoodThread(const MooseMesh & mesh,
                           const std::vector<dof_id_type> & trial_master_nodes,
                           const std::map<dof_id_type, std::vector<dof_id_type> > & node_to_elem_map,
-                          const unsigned int patch_size);
+                          const unsigned int patch_size,
+                          const KDTree & kd_tree);
 
 
   /// Splitting Constructor
@@ -58,6 +60,9 @@ protected:
 
   /// The number of nodes to keep
   unsigned int _patch_size;
+
+  /// k-d tree over the trial master nodes (indices into _trial_master_nodes)
+  const KDTree & _kd_tree;
 };
 
 #endif //SLAVENEIGHBORHOODTHREAD_H
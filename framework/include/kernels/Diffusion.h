@@ -16,6 +16,7 @@
 #define DIFFUSION_H
 
 #include "Kernel.h"
+#include "ElementBatch.h"
 
 class Diffusion;
 
@@ -31,10 +32,17 @@ class Diffusion : public Kernel
 public:
   Diffusion(const InputParameters & parameters);
 
+  virtual bool supportsBatch() const override;
+  virtual void storeBatchElement() override;
+  virtual void computeResidualBatch() override;
+
 protected:
   virtual Real computeQpResidual() override;
 
   virtual Real computeQpJacobian() override;
+
+  /// Element data stored for the batched residual evaluation
+  ElementBatch _batch;
 };
 
 
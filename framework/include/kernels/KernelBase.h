@@ -93,6 +93,18 @@ public:
    */
   virtual void computeNonlocalOffDiagJacobian(unsigned int /* jvar */) {}
 
+  /**
+   * Whether or not this Kernel can compute its residual over a batch of elements with
+   * storeBatchElement() and computeResidualBatch() instead of computeResidual()
+   */
+  virtual bool supportsBatch() const { return false; }
+
+  /// Store the data this Kernel needs from the current element for computeResidualBatch()
+  virtual void storeBatchElement();
+
+  /// Compute the residual of all elements stored since the last call and cache it in the Assembly object
+  virtual void computeResidualBatch();
+
   /// Returns the variable number that this Kernel operates on.
   MooseVariable & variable();
 
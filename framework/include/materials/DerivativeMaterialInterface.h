@@ -87,6 +87,20 @@ public:
   const MaterialProperty<U> & getMaterialPropertyDerivativeByName(const MaterialPropertyName & base, const VariableName & c1, const VariableName & c2 = "", const VariableName & c3 = "");
   ///@}
 
+  ///@{
+  /**
+   * Methods for retreiving derivative material properties that are only used to compute the
+   * Jacobian (see MaterialPropertyInterface::getJacobianMaterialProperty)
+   * @tparam U The material property type
+   * @param base The name of the property to take the derivative of
+   * @param c The variable(s) to take the derivatives with respect to
+   */
+  template<typename U>
+  const MaterialProperty<U> & getJacobianMaterialPropertyDerivative(const std::string & base, const std::vector<VariableName> & c);
+  template<typename U>
+  const MaterialProperty<U> & getJacobianMaterialPropertyDerivative(const std::string & base, const VariableName & c1, const VariableName & c2 = "", const VariableName & c3 = "");
+  ///@}
+
   ///@{
   /**
    * check if derivatives of the passed in material property exist w.r.t a variable
@@ -271,6 +285,30 @@ DerivativeMaterialInterface<T>::getMaterialPropertyDerivativeByName(const Materi
   return getDefaultMaterialPropertyByName<U>(propertyNameFirst(base, c1));
 }
 
+template<class T>
+template<typename U>
+const MaterialProperty<U> &
+DerivativeMaterialInterface<T>::getJacobianMaterialPropertyDerivative(const std::string & base, const std::vector<VariableName> & c)
+{
+  this->_jacobian_property_retrieval = true;
+  const MaterialProperty<U> & prop = getMaterialPropertyDerivative<U>(base, c);
+  this->_jacobian_property_retrieval = false;
+
+  return prop;
+}
+
+template<class T>
+template<typename U>
+const MaterialProperty<U> &
+DerivativeMaterialInterface<T>::getJacobianMaterialPropertyDerivative(const std::string & base, const VariableName & c1, const VariableName & c2, const VariableName & c3)
+{
+  this->_jacobian_property_retrieval = true;
+  const MaterialProperty<U> & prop = getMaterialPropertyDerivative<U>(base, c1, c2, c3);
+  this->_jacobian_property_retrieval = false;
+
+  return prop;
+}
+
 template<class T>
 template<typename U>
 void
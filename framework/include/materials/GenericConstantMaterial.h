@@ -37,6 +37,8 @@ class GenericConstantMaterial : public Material
 public:
   GenericConstantMaterial(const InputParameters & parameters);
 
+  virtual void computeProperties() override;
+
 protected:
   virtual void computeQpProperties() override;
 
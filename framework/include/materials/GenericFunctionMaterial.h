@@ -37,6 +37,8 @@ class GenericFunctionMaterial : public Material
 public:
   GenericFunctionMaterial(const InputParameters & parameters);
 
+  virtual void computeProperties() override;
+
 protected:
   virtual void initQpStatefulProperties() override;
   virtual void computeQpProperties() override;
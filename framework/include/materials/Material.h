@@ -84,6 +84,12 @@ public:
 
   /**
    * Performs the quadrature point loop, calling computeQpProperties
+   *
+   * Materials whose properties are cheap to evaluate can override this method to fill
+   * all quadrature points of the current element in one pass (one loop per property over
+   * the contiguous property arrays) instead of paying a virtual call per quadrature point.
+   * computeQpProperties() still has to be implemented for computePropertiesAtQp(), and the
+   * override should call Material::computeProperties() when 'batch_qp = false'.
    */
   virtual void computeProperties();
 
@@ -146,6 +152,17 @@ public:
   template<typename T>
   const MaterialProperty<T> & getZeroMaterialProperty(const std::string & prop_name);
 
+  ///@{
+  /**
+   * Materials do not know whether their consumers evaluate a residual or a Jacobian, so they
+   * have to retrieve the properties they depend on with getMaterialProperty.
+   */
+  template<typename T>
+  const MaterialProperty<T> & getJacobianMaterialProperty(const std::string & name) = delete;
+  template<typename T>
+  const MaterialProperty<T> & getJacobianMaterialPropertyByName(const MaterialPropertyName & name) = delete;
+  ///@}
+
   /**
    * Return a set of properties accessed with getMaterialProperty
    * @return A reference to the set of properties with calls to getMaterialProperty
@@ -162,6 +179,11 @@ public:
   const std::set<std::string> &
   getSuppliedItems() override { return _supplied_props; }
 
+  /**
+   * Return the set of ids of the properties declared by this material
+   */
+  const std::set<unsigned int> & getSuppliedPropIDs() const { return _supplied_prop_ids; }
+
   void checkStatefulSanity() const;
 
   /**
@@ -198,6 +220,21 @@ protected:
    */
   virtual void initQpStatefulProperties();
 
+  /**
+   * Mark a declared property as only needed for the Jacobian. Such a property does not have
+   * to be computed in loops whose objects only retrieved it with getJacobianMaterialProperty,
+   * see isPropertyNeeded().
+   * @param prop_name The name of the declared property
+   * @return The id of the property
+   */
+  unsigned int setJacobianOnlyProperty(const std::string & prop_name);
+
+  /**
+   * Whether or not the property with the given id has to be computed on the current element.
+   * This is false only for Jacobian-only properties that no object of the current loop consumes.
+   */
+  bool isPropertyNeeded(unsigned int prop_id);
+
   SubProblem & _subproblem;
 
   FEProblemBase & _fe_problem;
@@ -232,9 +269,18 @@ protected:
   /// Set of properties declared
   std::set<std::string> _supplied_props;
 
+  /// Set of ids of the properties declared
+  std::set<unsigned int> _supplied_prop_ids;
+
+  /// Set of ids of the declared properties that are only needed for the Jacobian
+  std::set<unsigned int> _jacobian_only_prop_ids;
+
   /// If False MOOSE does not compute this property
   const bool _compute;
 
+  /// If False the whole element computeProperties() overrides fall back to the per qp loop
+  const bool _batch_qp;
+
   enum QP_Data_Type {
     CURR,
     PREV
@@ -313,7 +359,9 @@ Material::getMaterialPropertyByName(const std::string & prop_name)
   _requested_props.insert(prop_name);
   registerPropName(prop_name, true, Material::CURRENT);
   _fe_problem.markMatPropRequested(prop_name);
-  return _material_data->getProperty<T>(prop_name);
+  const MaterialProperty<T> & prop = _material_data->getProperty<T>(prop_name);
+  _material_property_dependencies.insert(_material_data->getPropertyId(prop_name));
+  return prop;
 }
 
 template<typename T>
@@ -323,7 +371,9 @@ Material::getMaterialPropertyOldByName(const std::string & prop_name)
   _requested_props.insert(prop_name);
   registerPropName(prop_name, true, Material::OLD);
   _fe_problem.markMatPropRequested(prop_name);
-  return _material_data->getPropertyOld<T>(prop_name);
+  const MaterialProperty<T> & prop = _material_data->getPropertyOld<T>(prop_name);
+  _material_property_dependencies.insert(_material_data->getPropertyId(prop_name));
+  return prop;
 }
 
 template<typename T>
@@ -333,7 +383,9 @@ Material::getMaterialPropertyOlderByName(const std::string & prop_name)
   _requested_props.insert(prop_name);
   registerPropName(prop_name, true, Material::OLDER);
   _fe_problem.markMatPropRequested(prop_name);
-  return _material_data->getPropertyOlder<T>(prop_name);
+  const MaterialProperty<T> & prop = _material_data->getPropertyOlder<T>(prop_name);
+  _material_property_dependencies.insert(_material_data->getPropertyId(prop_name));
+  return prop;
 }
 
 
@@ -342,7 +394,9 @@ MaterialProperty<T> &
 Material::declareProperty(const std::string & prop_name)
 {
   registerPropName(prop_name, false, Material::CURRENT);
-  return _material_data->declareProperty<T>(prop_name);
+  MaterialProperty<T> & prop = _material_data->declareProperty<T>(prop_name);
+  _supplied_prop_ids.insert(_material_data->getPropertyId(prop_name));
+  return prop;
 }
 
 template<typename T>
@@ -350,7 +404,9 @@ MaterialProperty<T> &
 Material::declarePropertyOld(const std::string & prop_name)
 {
   registerPropName(prop_name, false, Material::OLD);
-  return _material_data->declarePropertyOld<T>(prop_name);
+  MaterialProperty<T> & prop = _material_data->declarePropertyOld<T>(prop_name);
+  _supplied_prop_ids.insert(_material_data->getPropertyId(prop_name));
+  return prop;
 }
 
 template<typename T>
@@ -358,7 +414,9 @@ MaterialProperty<T> &
 Material::declarePropertyOlder(const std::string & prop_name)
 {
   registerPropName(prop_name, false, Material::OLDER);
-  return _material_data->declarePropertyOlder<T>(prop_name);
+  MaterialProperty<T> & prop = _material_data->declarePropertyOlder<T>(prop_name);
+  _supplied_prop_ids.insert(_material_data->getPropertyId(prop_name));
+  return prop;
 }
 
 template<typename T>
@@ -371,6 +429,7 @@ Material::getZeroMaterialProperty(const std::string & prop_name)
   _requested_props.insert(prop_name);
   registerPropName(prop_name, true, Material::CURRENT);
   _fe_problem.markMatPropRequested(prop_name);
+  _material_property_dependencies.insert(_material_data->getPropertyId(prop_name));
 
   // Register this material on these blocks and boundaries as a zero property with relaxed consistency checking
   for (std::set<SubdomainID>::const_iterator it = blockIDs().begin(); it != blockIDs().end(); ++it)
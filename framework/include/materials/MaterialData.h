@@ -139,6 +139,11 @@ public:
    */
   const MaterialPropertyStorage & getMaterialPropertyStorage() const { return _storage; }
 
+  /**
+   * The global id of an existing property
+   */
+  unsigned int getPropertyId(const std::string & prop_name) const { return _storage.retrievePropertyId(prop_name); }
+
 protected:
 
   /// Reference to the MaterialStorage class
@@ -81,6 +81,27 @@ public:
    */
   virtual void qpCopy (const unsigned int to_qp, PropertyValue *rhs, const unsigned int from_qp) = 0;
 
+  /**
+   * Copy n consecutive values of a Property into this Property.
+   *
+   * @param to_qp The first quadrature point in _this_ Property that you want to copy to.
+   * @param rhs The Property you want to copy _from_.
+   * @param from_qp The first quadrature point in rhs you want to copy _from_.
+   * @param n The number of values to copy
+   */
+  virtual void qpCopyRange (const unsigned int to_qp, PropertyValue *rhs, const unsigned int from_qp, const unsigned int n) = 0;
+
+  /**
+   * Make this Property operate on n values of another Property without copying them.
+   * The values this Property held before are NOT released, this is only meant for
+   * properties that are used as views into other properties.
+   *
+   * @param rhs The Property to look at, NULL detaches this Property from any values.
+   * @param from_qp The first quadrature point in rhs.
+   * @param n The number of values.
+   */
+  virtual void shallowCopyRange (PropertyValue *rhs, const unsigned int from_qp, const unsigned int n) = 0;
+
   // save/restore in a file
   virtual void store(std::ostream & stream) = 0;
   virtual void load(std::istream & stream) = 0;
@@ -168,6 +189,25 @@ public:
    */
   virtual void qpCopy (const unsigned int to_qp, PropertyValue *rhs, const unsigned int from_qp);
 
+  /**
+   * Copy n consecutive values of a Property into this Property.
+   *
+   * @param to_qp The first quadrature point in _this_ Property that you want to copy to.
+   * @param rhs The Property you want to copy _from_.
+   * @param from_qp The first quadrature point in rhs you want to copy _from_.
+   * @param n The number of values to copy
+   */
+  virtual void qpCopyRange (const unsigned int to_qp, PropertyValue *rhs, const unsigned int from_qp, const unsigned int n);
+
+  /**
+   * Make this Property operate on n values of another Property without copying them.
+   *
+   * @param rhs The Property to look at, NULL detaches this Property from any values.
+   * @param from_qp The first quadrature point in rhs.
+   * @param n The number of values.
+   */
+  virtual void shallowCopyRange (PropertyValue *rhs, const unsigned int from_qp, const unsigned int n);
+
   /**
    * Store the property into a binary stream
    */
@@ -248,6 +288,26 @@ MaterialProperty<T>::qpCopy (const unsigned int to_qp, PropertyValue *rhs, const
   _value[to_qp] = cast_ptr<const MaterialProperty<T>*>(rhs)->_value[from_qp];
 }
 
+template <typename T>
+inline void
+MaterialProperty<T>::qpCopyRange (const unsigned int to_qp, PropertyValue *rhs, const unsigned int from_qp, const unsigned int n)
+{
+  mooseAssert(rhs != NULL, "Assigning NULL?");
+  const MooseArray<T> & from = cast_ptr<const MaterialProperty<T>*>(rhs)->_value;
+  for (unsigned int i = 0; i < n; i++)
+    _value[to_qp + i] = from[from_qp + i];
+}
+
+template <typename T>
+inline void
+MaterialProperty<T>::shallowCopyRange (PropertyValue *rhs, const unsigned int from_qp, const unsigned int n)
+{
+  if (rhs == NULL)
+    _value.shallowCopy(MooseArray<T>());
+  else
+    _value.shallowCopy(cast_ptr<const MaterialProperty<T>*>(rhs)->_value, from_qp, n);
+}
+
 template<typename T>
 inline void
 MaterialProperty<T>::store(std::ostream & stream)
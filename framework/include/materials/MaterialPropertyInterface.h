@@ -96,6 +96,20 @@ public:
   const MaterialProperty<T> & getMaterialPropertyOlderByName(const MaterialPropertyName & name);
   ///@}
 
+  ///@{
+  /**
+   * Retrieve reference to a material property that is only used while computing the Jacobian.
+   * Materials may skip properties marked as Jacobian-only in loops (such as the residual
+   * evaluation) whose objects only retrieved them through these methods.
+   * @param name The name of the parameter key or of the material property to retrieve
+   * @return Reference to the desired material property
+   */
+  template<typename T>
+  const MaterialProperty<T> & getJacobianMaterialProperty(const std::string & name);
+  template<typename T>
+  const MaterialProperty<T> & getJacobianMaterialPropertyByName(const MaterialPropertyName & name);
+  ///@}
+
   /**
    * Retrieve pointer to a material property with the mesh blocks where it is defined
    * The name required by this method is the name defined in the input file.
@@ -175,6 +189,16 @@ public:
    */
   bool getMaterialPropertyCalled() const { return _get_material_property_called; }
 
+  /**
+   * Retrieve the set of material property ids this object depends on
+   */
+  const std::set<unsigned int> & getMatPropDependencies() const { return _material_property_dependencies; }
+
+  /**
+   * Retrieve the set of material property ids this object only depends on while computing the Jacobian
+   */
+  const std::set<unsigned int> & getJacobianMatPropDependencies() const { return _jacobian_material_property_dependencies; }
+
 protected:
   /// Parameters of the object with this interface
   const InputParameters & _mi_params;
@@ -239,6 +263,15 @@ protected:
    */
   bool _get_material_property_called;
 
+  /// The set of material property ids retrieved by this object
+  std::set<unsigned int> _material_property_dependencies;
+
+  /// The set of material property ids retrieved by this object for the Jacobian only
+  std::set<unsigned int> _jacobian_material_property_dependencies;
+
+  /// True while a property is retrieved through getJacobianMaterialProperty
+  bool _jacobian_property_retrieval;
+
   /// Storage vector for MaterialProperty<Real> default objects
   std::vector<std::unique_ptr<MaterialProperty<Real>>> _default_real_properties;
 
@@ -362,7 +395,39 @@ MaterialPropertyInterface::getMaterialPropertyByName(const MaterialPropertyName
   // Update the boolean flag.
   _get_material_property_called = true;
 
-  return _material_data->getProperty<T>(name);
+  const MaterialProperty<T> & prop = _material_data->getProperty<T>(name);
+  if (_jacobian_property_retrieval)
+    _jacobian_material_property_dependencies.insert(_material_data->getPropertyId(name));
+  else
+    _material_property_dependencies.insert(_material_data->getPropertyId(name));
+
+  return prop;
+}
+
+template<typename T>
+const MaterialProperty<T> &
+MaterialPropertyInterface::getJacobianMaterialProperty(const std::string & name)
+{
+  // Check if the supplied parameter is a valid input parameter key
+  std::string prop_name = deducePropertyName(name);
+
+  // Check if it's just a constant
+  const MaterialProperty<T> * default_property = defaultMaterialProperty<T>(prop_name);
+  if (default_property)
+    return *default_property;
+
+  return getJacobianMaterialPropertyByName<T>(prop_name);
+}
+
+template<typename T>
+const MaterialProperty<T> &
+MaterialPropertyInterface::getJacobianMaterialPropertyByName(const MaterialPropertyName & name)
+{
+  _jacobian_property_retrieval = true;
+  const MaterialProperty<T> & prop = getMaterialPropertyByName<T>(name);
+  _jacobian_property_retrieval = false;
+
+  return prop;
 }
 
 
@@ -377,7 +442,10 @@ MaterialPropertyInterface::getMaterialPropertyOldByName(const MaterialPropertyNa
   // mark property as requested
   markMatPropRequested(name);
 
-  return _material_data->getPropertyOld<T>(name);
+  const MaterialProperty<T> & prop = _material_data->getPropertyOld<T>(name);
+  _material_property_dependencies.insert(_material_data->getPropertyId(name));
+
+  return prop;
 }
 
 template<typename T>
@@ -391,7 +459,10 @@ MaterialPropertyInterface::getMaterialPropertyOlderByName(const MaterialProperty
   // mark property as requested
   markMatPropRequested(name);
 
-  return _material_data->getPropertyOlder<T>(name);
+  const MaterialProperty<T> & prop = _material_data->getPropertyOlder<T>(name);
+  _material_property_dependencies.insert(_material_data->getPropertyId(name));
+
+  return prop;
 }
 
 template<typename T>
@@ -19,6 +19,8 @@
 #include "MaterialProperty.h"
 #include "HashMap.h"
 
+#include <unordered_map>
+
 // Forward declarations
 class Material;
 class MaterialData;
@@ -156,6 +158,33 @@ public:
    */
   bool hasOlderProperties() const { return _has_older_prop; }
 
+  /**
+   * Switch between the per-element hash map storage and the flat arena storage.
+   *
+   * In arena mode every stateful property is kept in a few large arrays (chunks) per time level
+   * (current, old, older) that hold the quadrature points of many (element, side) pairs.  The
+   * location of each (element, side) block is kept in an offset table shared by the three levels,
+   * so shift() only rotates three pointers and restart streams whole arrays.  The arrays are
+   * allocated in chunks that never move, swap() points the properties of MaterialData at the
+   * block of an element instead of copying the values.
+   *
+   * This has to be set before any property storage is allocated.
+   */
+  void useArena(bool use_arena);
+
+  /**
+   * @return true if the flat arena storage is used
+   */
+  bool usingArena() const { return _use_arena; }
+
+  ///@{
+  /**
+   * Store/load the arena storage (offset table followed by whole property arrays)
+   */
+  void storeArena(std::ostream & stream, void * context);
+  void loadArena(std::istream & stream, void * context);
+  ///@}
+
   ///@{
   /**
    * Access methods to the stored material property data
@@ -212,12 +241,121 @@ protected:
   unsigned int addPropertyId (const std::string & prop_name);
 
   void sizeProps(MaterialProperties & mp, unsigned int size);
+
+  /// Location of the quadrature point block of one (element, side) pair inside the arenas
+  struct ArenaSlot
+  {
+    unsigned int _chunk;
+    unsigned int _offset;
+    unsigned int _n_qpoints;
+  };
+
+  /// The chunks (one per time level) holding a block, see arenaBlock()
+  struct ArenaBlock
+  {
+    MaterialProperties * _props;
+    MaterialProperties * _props_old;
+    MaterialProperties * _props_older;
+  };
+
+  /// Properties of one MaterialData object that swap() points at the blocks of the arenas
+  struct ArenaViews
+  {
+    MaterialProperties _props;
+    MaterialProperties _props_old;
+    MaterialProperties _props_older;
+  };
+
+  /**
+   * Key into the arena offset table
+   */
+  static uint64_t arenaKey(const Elem & elem, unsigned int side);
+
+  /**
+   * Find the arena block of an element side, handing out a new one if needed.
+   * The caller is responsible for holding Threads::spin_mtx.
+   * @param material_data MaterialData object used as a prototype when the arenas need to be created
+   * @return The slot of the (element, side) pair
+   */
+  const ArenaSlot & arenaSlot(MaterialData & material_data, const Elem & elem, unsigned int side, unsigned int n_qpoints);
+
+  /**
+   * Find the arena block of an element side that has been handed out before.
+   * The caller is responsible for holding Threads::spin_mtx.
+   * @return NULL if the (element, side) pair has no storage
+   */
+  const ArenaSlot * findArenaSlot(const Elem & elem, unsigned int side) const;
+
+  /**
+   * The chunks holding the block of a slot.  The chunks never move, so they can be used after
+   * Threads::spin_mtx is released.
+   * The caller is responsible for holding Threads::spin_mtx.
+   */
+  ArenaBlock arenaBlock(const ArenaSlot & slot) const;
+
+  /**
+   * Add a chunk that can hold at least n_qpoints quadrature points to the arenas.
+   * The caller is responsible for holding Threads::spin_mtx.
+   */
+  void addArenaChunk(MaterialData & material_data, unsigned int n_qpoints);
+
+  /**
+   * Add a chunk that can hold capacity quadrature points to the arenas (the prototypes have to exist)
+   */
+  void pushArenaChunk(unsigned int capacity);
+
+  /**
+   * The views used by swap() for a MaterialData object, created the first time they are needed.
+   * The caller is responsible for holding Threads::spin_mtx.
+   */
+  ArenaViews & arenaViews(MaterialData & material_data);
+
+  /**
+   * Detach the views from the arenas and delete them
+   */
+  void releaseArenaViews();
+
+  /// true if the flat arena storage is used instead of the hash maps
+  bool _use_arena;
+
+  ///@{
+  /// Arena chunks, indexed by [chunk][stateful property id].  A chunk is never moved or resized
+  /// once it has been created (except when loading a restart file), so the blocks it holds can be
+  /// used in place while other threads add chunks.
+  std::vector<MaterialProperties *> * _arena;
+  std::vector<MaterialProperties *> * _arena_old;
+  std::vector<MaterialProperties *> * _arena_older;
+  ///@}
+
+  /// Number of quadrature points handed out in each chunk
+  std::vector<unsigned int> _arena_chunk_size;
+
+  /// Number of quadrature points each chunk can hold
+  std::vector<unsigned int> _arena_chunk_capacity;
+
+  /// One empty property per stateful property, used to create the chunks and views
+  MaterialProperties _arena_prototype;
+
+  /// offset table shared by the current, old and older arenas
+  std::unordered_map<uint64_t, ArenaSlot> _arena_slots;
+
+  /// The views of every MaterialData object that has been swapped with the arenas
+  std::map<const MaterialData *, ArenaViews> _arena_views;
+
+  /// Number of quadrature points in a chunk (unless an element needs more)
+  static const unsigned int ARENA_CHUNK_SIZE;
 };
 
 template<>
 inline void
 dataStore(std::ostream & stream, MaterialPropertyStorage & storage, void * context)
 {
+  if (storage.usingArena())
+  {
+    storage.storeArena(stream, context);
+    return;
+  }
+
   dataStore(stream, storage.props(), context);
   dataStore(stream, storage.propsOld(), context);
 
@@ -229,6 +367,12 @@ template<>
 inline void
 dataLoad(std::istream & stream, MaterialPropertyStorage & storage, void * context)
 {
+  if (storage.usingArena())
+  {
+    storage.loadArena(stream, context);
+    return;
+  }
+
   dataLoad(stream, storage.props(), context);
   dataLoad(stream, storage.propsOld(), context);
 
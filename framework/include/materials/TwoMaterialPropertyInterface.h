@@ -71,8 +71,13 @@ TwoMaterialPropertyInterface::getNeighborMaterialProperty(const std::string & na
   const MaterialProperty<T> * default_property = defaultMaterialProperty<T>(prop_name);
   if (default_property)
     return *default_property;
-  else
-    return _neighbor_material_data->getProperty<T>(prop_name);
+
+  const MaterialProperty<T> & prop = _neighbor_material_data->getProperty<T>(prop_name);
+
+  // The neighbor properties are computed by the same materials, so they are dependencies too
+  _material_property_dependencies.insert(_neighbor_material_data->getPropertyId(prop_name));
+
+  return prop;
 }
 
 template<typename T>
@@ -86,8 +91,13 @@ TwoMaterialPropertyInterface::getNeighborMaterialPropertyOld(const std::string &
   const MaterialProperty<T> * default_property = defaultMaterialProperty<T>(prop_name);
   if (default_property)
     return *default_property;
-  else
-    return _neighbor_material_data->getPropertyOld<T>(prop_name);
+
+  const MaterialProperty<T> & prop = _neighbor_material_data->getPropertyOld<T>(prop_name);
+
+  // The neighbor properties are computed by the same materials, so they are dependencies too
+  _material_property_dependencies.insert(_neighbor_material_data->getPropertyId(prop_name));
+
+  return prop;
 }
 
 template<typename T>
@@ -101,8 +111,13 @@ TwoMaterialPropertyInterface::getNeighborMaterialPropertyOlder(const std::string
   const MaterialProperty<T> * default_property = defaultMaterialProperty<T>(prop_name);
   if (default_property)
     return *default_property;
-  else
-    return _neighbor_material_data->getPropertyOlder<T>(prop_name);
+
+  const MaterialProperty<T> & prop = _neighbor_material_data->getPropertyOlder<T>(prop_name);
+
+  // The neighbor properties are computed by the same materials, so they are dependencies too
+  _material_property_dependencies.insert(_neighbor_material_data->getPropertyId(prop_name));
+
+  return prop;
 }
 
 #endif //TWOMATERIALPROPERTYINTERFACE_H
@@ -312,6 +312,17 @@ public:
    */
   bool isSemiLocal(Node * node);
 
+  /**
+   * Position of an element in the active local element range, or libMesh::invalid_uint if it
+   * isn't in that range (or the range hasn't been built yet).
+   */
+  unsigned int activeLocalElementIndex(const Elem * elem) const
+  {
+    // Ids below the first local one wrap around and fail the size check
+    dof_id_type i = elem->id() - _first_active_local_elem_id;
+    return i < _active_local_elem_index.size() ? _active_local_elem_index[i] : libMesh::invalid_uint;
+  }
+
   /**
    * Return pointers to range objects for various types of ranges
    * (local nodes, boundary elems, etc.).
@@ -323,6 +334,17 @@ public:
   StoredRange<MooseMesh::const_bnd_node_iterator, const BndNode*> * getBoundaryNodeRange();
   StoredRange<MooseMesh::const_bnd_elem_iterator, const BndElement*> * getBoundaryElementRange();
 
+  /**
+   * Return the active local elements split into colors. Elements of the same color
+   * do not share any node, so threads working on a single color never touch the same
+   * nodal degrees of freedom. The coloring is built on first use and discarded when the
+   * mesh changes.
+   * @param face_neighbors Also keep elements apart whose face neighbors share a node with
+   *        each other or with the element (distance-2 coloring). Required when DG or
+   *        interface kernels write to the degrees of freedom of the neighbor.
+   */
+  const std::vector<std::unique_ptr<ConstElemRange> > & getColoredElementRanges(bool face_neighbors = false);
+
   /**
    * Returns a read-only reference to the set of subdomains currently
    * present in the Mesh.
@@ -431,6 +453,11 @@ public:
    */
   const MooseEnum & getPatchUpdateStrategy() const;
 
+  /**
+   * Get the number of timesteps between patch rebuilds (patch_update_strategy = always)
+   */
+  unsigned int getPatchUpdateInterval() const;
+
   /**
    * Get a (slightly inflated) processor bounding box.
    *
@@ -853,12 +880,24 @@ protected:
    */
   std::unique_ptr<ConstElemRange> _active_local_elem_range;
 
+  ///@{
+  /// Position in _active_local_elem_range of the elements, indexed by id - _first_active_local_elem_id
+  std::vector<unsigned int> _active_local_elem_index;
+  dof_id_type _first_active_local_elem_id;
+  ///@}
+
   std::unique_ptr<SemiLocalNodeRange> _active_semilocal_node_range;
   std::unique_ptr<NodeRange> _active_node_range;
   std::unique_ptr<ConstNodeRange> _local_node_range;
   std::unique_ptr<StoredRange<MooseMesh::const_bnd_node_iterator, const BndNode*> > _bnd_node_range;
   std::unique_ptr<StoredRange<MooseMesh::const_bnd_elem_iterator, const BndElement*> > _bnd_elem_range;
 
+  /// The active local elements grouped by color (see getColoredElementRanges())
+  std::vector<std::unique_ptr<ConstElemRange> > _colored_elem_ranges;
+
+  /// Whether the face neighbors were taken into account when _colored_elem_ranges was built
+  bool _colored_face_neighbors;
+
   /// A map of all of the current nodes to the elements that they are connected to.
   std::map<dof_id_type, std::vector<dof_id_type> > _node_to_elem_map;
   bool _node_to_elem_map_built;
@@ -922,6 +961,9 @@ protected:
   /// The patch update strategy
   MooseEnum _patch_update_strategy;
 
+  /// The number of timesteps between patch rebuilds
+  unsigned int _patch_update_interval;
+
   /// file_name iff this mesh was read from a file
   std::string _file_name;
 
@@ -25,6 +25,7 @@ class FEProblem;
 class Executioner;
 class MooseApp;
 class Backup;
+class MultiAppTransfer;
 
 // libMesh forward declarations
 namespace libMesh
@@ -239,6 +240,14 @@ public:
    */
   virtual void parentOutputPositionChanged();
 
+  /**
+   * Register a Transfer whose MultiAppTransfer::appsMoved() method is called every time Apps of
+   * this MultiApp change processors.
+   *
+   * @param transfer The Transfer to notify
+   */
+  void addAppsMovedListener(MultiAppTransfer & transfer);
+
   /**
    * Get the MPI communicator this MultiApp is operating on.
    * @return The MPI comm for this MultiApp
@@ -272,6 +281,71 @@ protected:
    */
   void buildComm();
 
+  /**
+   * Split the Apps into contiguous chunks of similar total cost, one per processor.  Only valid
+   * when there are at least as many Apps as processors (every processor works on its Apps using
+   * MPI_COMM_SELF).
+   *
+   * @param costs The cost of every global App
+   * @return The first global App of every processor followed by the total number of Apps
+   */
+  std::vector<unsigned int> partitionAppsByCost(const std::vector<Real> & costs) const;
+
+  /**
+   * Move Apps between processors so that every processor gets a contiguous chunk of Apps with a
+   * similar total cost.  Each App that changes processor is backed up, sent to its new processor
+   * and restored into a newly created App there.  Only valid when there are at least as many
+   * Apps as processors.
+   *
+   * @param costs The cost of every global App
+   * @return Whether or not any App changed processor
+   */
+  bool redistributeApps(const std::vector<Real> & costs);
+
+  /**
+   * Tell the registered Transfers that Apps changed processors.  Must be called on all processors.
+   */
+  void notifyAppsMoved();
+
+  /**
+   * Serialize the state of a local App, together with its Backup for repeating the step, and delete
+   * the App.  The result is turned back into an App by unpackApp() on another processor.
+   *
+   * @param local_app The local app number
+   * @return The packed App
+   */
+  std::string packApp(unsigned int local_app);
+
+  /**
+   * Create a local App from the state packed by packApp() on another processor.
+   *
+   * @param local_app The local app number
+   * @param packed_app The packed App
+   */
+  void unpackApp(unsigned int local_app, const std::string & packed_app);
+
+  /**
+   * Remove the last local App so that the next processor can take it over with adoptPreviousApp().
+   * Only valid when every processor works on whole Apps.
+   *
+   * @return The packed App
+   */
+  std::string releaseLastApp();
+
+  /**
+   * Add the last App of the previous processor, released by releaseLastApp(), in front of the local Apps.
+   *
+   * @param packed_app The packed App
+   */
+  void adoptPreviousApp(const std::string & packed_app);
+
+  /**
+   * Called by unpackApp() for every App created on this processor, before its state is restored.
+   *
+   * @param local_app The local app number
+   */
+  virtual void setupMovedApp(unsigned int local_app);
+
   /**
    * Map a global App number to the local number.
    * Note: This will error if given a global number that doesn't map to a local number.
@@ -335,6 +409,9 @@ protected:
   /// Maximum number of processors to give to each app
   unsigned int _max_procs_per_app;
 
+  /// Estimated relative cost of each App (empty if Apps should be distributed by count)
+  std::vector<Real> _app_costs;
+
   /// Whether or not to move the output of the MultiApp into position
   bool _output_in_position;
 
@@ -364,6 +441,9 @@ protected:
 
   /// Backups for each local App
   SubAppBackups & _backups;
+
+  /// Transfers to notify when Apps change processors
+  std::vector<MultiAppTransfer *> _apps_moved_listeners;
 };
 
 template<>
@@ -53,7 +53,47 @@ public:
    */
   Real computeDT();
 
+protected:
+  virtual void setupMovedApp(unsigned int local_app) override;
+
 private:
+  /**
+   * Solve the local App i up to target_time.
+   *
+   * @param i The local app number
+   * @param dt The master time step
+   * @param target_time The global time to solve to
+   * @param auto_advance Whether or not to finish the time step of the App
+   */
+  void solveApp(unsigned int i, Real dt, Real target_time, bool auto_advance);
+
+  /**
+   * Answer the work requests of the next processor by giving it the last local App, as long as
+   * this processor keeps another unstarted App for itself.
+   *
+   * @param n_unstarted The number of local Apps (at the end of the list) that have not been started
+   * @param wait Whether to wait for a request instead of only answering the pending ones
+   */
+  void shareApps(unsigned int n_unstarted, bool wait);
+
+  /**
+   * Ask the previous processor for Apps and solve them until it has none left to give.
+   */
+  void stealApps(Real dt, Real target_time, bool auto_advance);
+
+  /**
+   * Complete the work request exchange with both neighbors at the end of a step.
+   */
+  void finishSharingApps();
+
+  /**
+   * Every 'rebalance_interval' steps, redistribute the Apps among the processors according to the
+   * time spent solving them if the processors are out of balance by more than 'rebalance_tolerance'.
+   *
+   * @param solved Whether or not this processor solved all of its Apps successfully
+   */
+  void rebalanceApps(bool solved);
+
   /**
    * Setup the executioner for the local app.
    *
@@ -95,6 +135,33 @@ private:
 
   /// Flag for toggling console output on sub cycles
   bool _print_sub_cycles;
+
+  /// Number of steps between redistributions of the Apps (0 means never)
+  unsigned int _rebalance_interval;
+
+  /// Relative processor imbalance above which the Apps are redistributed
+  Real _rebalance_tolerance;
+
+  /// Time spent solving each local App since the last rebalance
+  std::vector<Real> _app_solve_times;
+
+  /// Number of steps since the Apps were last considered for redistribution
+  unsigned int _steps_since_rebalance;
+
+  /// Whether processors that run out of Apps during a step take over Apps of the previous processor
+  bool _dynamic_load_balancing;
+
+  /// Communicator for the work requests between neighboring processors
+  Parallel::Communicator _work_comm;
+
+  /// Whether the previous processor has no more Apps to give during this step
+  bool _prev_proc_done;
+
+  /// Whether the next processor stopped asking for Apps during this step
+  bool _next_proc_done;
+
+  /// Whether this processor gave away or took over an App during this step
+  bool _apps_moved;
 };
 
 /**
@@ -0,0 +1,97 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ASYNCOUTPUTWRITER_H
+#define ASYNCOUTPUTWRITER_H
+
+// C++ includes
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * Runs file writes on a background thread so that the solve can continue while they complete.
+ *
+ * The jobs are executed in the order they were queued. The queue is bounded: queue() blocks while
+ * the given number of jobs is waiting, so a writer that can't keep up slows the simulation down
+ * instead of buffering an unbounded number of snapshots.
+ *
+ * Jobs must only touch data they own (a snapshot taken when the job was queued) or data that
+ * nothing else uses while jobs are pending; in particular they must not communicate through MPI
+ * or call mooseError().  A job returns an error message (empty on success), which is reported
+ * with a warning by the next call to queue() or wait() on the main thread.  The jobs that were
+ * queued after a failed one are dropped.
+ */
+class AsyncOutputWriter
+{
+public:
+  /**
+   * @param max_queued The number of jobs that may be waiting before queue() blocks
+   */
+  AsyncOutputWriter(unsigned int max_queued);
+
+  /**
+   * Finishes the queued jobs and stops the thread
+   */
+  ~AsyncOutputWriter();
+
+  /**
+   * Add a job to the queue, blocks while the queue is full
+   */
+  void queue(std::function<std::string()> job);
+
+  /**
+   * Block until all the queued jobs are finished
+   */
+  void wait();
+
+private:
+  /// Run the jobs until stopped
+  void run();
+
+  /// Calls mooseWarning() with the message of a job that failed (if any)
+  void checkError();
+
+  /// The number of jobs that may be waiting
+  const unsigned int _max_queued;
+
+  /// The waiting jobs
+  std::deque<std::function<std::string()> > _jobs;
+
+  /// Whether or not a job is being executed
+  bool _busy;
+
+  /// Set when the thread should exit once the queue is empty
+  bool _stop;
+
+  /// Error message of the first job that failed
+  std::string _error;
+
+  /// Protects all of the above
+  std::mutex _mutex;
+
+  /// Signaled when a job is queued or the thread should stop
+  std::condition_variable _job_queued;
+
+  /// Signaled when a job is finished
+  std::condition_variable _job_done;
+
+  /// The writer thread (declared last so that it starts once everything else is constructed)
+  std::thread _thread;
+};
+
+#endif // ASYNCOUTPUTWRITER_H
@@ -0,0 +1,156 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BINARYTABLE_H
+#define BINARYTABLE_H
+
+// MOOSE includes
+#include "AdvancedOutput.h"
+#include "FileOutput.h"
+
+// C++ includes
+#include <fstream>
+#include <map>
+#include <tuple>
+
+// Forward declarations
+class BinaryTable;
+
+template<>
+InputParameters validParams<BinaryTable>();
+
+/**
+ * Writes the history of the postprocessors, scalar variables and vector postprocessors to a
+ * single binary file made of column oriented blocks.
+ *
+ * The file starts with the 8 byte magic "MOOSETAB" and a uint32 version.  Every block holds
+ * one table: the postprocessors and scalar variables ("postprocessors", several rows per block)
+ * or one VectorPostprocessor (named after it, one block per output).  A block is
+ *
+ *   "BLCK", uint32 name length, name, float64 time, uint8 compression (0 none, 1 zlib),
+ *   uint64 raw size, uint64 stored size, payload
+ *
+ * and the uncompressed payload is a uint32 column count followed by, for every column,
+ * uint32 name length, name, char type ('d' float64 or 'q' int64), uint64 count and the values.
+ * Every block has a "time" (float64) and a "timestep" (int64) column.  The postprocessor blocks
+ * hold one row per output with a column for each postprocessor and scalar variable component,
+ * a VectorPostprocessor block holds one column per vector.  Blocks are only ever appended.  When
+ * the simulation finishes an index with the offset, time and table of every block is written
+ * after the last block:
+ *
+ *   "INDX", uint64 block count, (uint64 offset, float64 time, uint32 name length, name) per block,
+ *   uint64 offset of "INDX", "MTABINDX"
+ *
+ * Files without an index (e.g. from a run that didn't finish) can be read by walking the blocks.
+ * When recovering, the blocks written before the checkpoint are kept and the new blocks are
+ * appended after them.
+ * All values are written in the native byte order.  See python/postprocessing/binary_table.py
+ * for a reader.
+ */
+class BinaryTable : public AdvancedOutput<FileOutput>
+{
+public:
+  BinaryTable(const InputParameters & parameters);
+
+  /**
+   * Writes the buffered rows and the block index
+   */
+  virtual ~BinaryTable();
+
+  virtual std::string filename() override;
+
+protected:
+  virtual void output(const ExecFlagType & type) override;
+
+  virtual void outputPostprocessors() override;
+
+  virtual void outputScalarVariables() override;
+
+  virtual void outputVectorPostprocessors() override;
+
+private:
+  /// A named column of a block along with its type code and values
+  struct Column
+  {
+    std::string name;
+    char type;
+    std::vector<Real> real_values;
+    std::vector<long long> int_values;
+  };
+
+  /**
+   * Add a value to the row of the postprocessor table for the current time
+   */
+  void addRowData(const std::string & name, Real value);
+
+  /**
+   * Write the buffered postprocessor rows as a block
+   */
+  void writePostprocessorBlock();
+
+  /**
+   * Write a block (on the background thread with 'asynchronous = true')
+   * @param table The name of the table the block belongs to
+   * @param time The time of the (first row of the) block
+   * @param columns The columns of the block
+   */
+  void writeBlock(const std::string & table, Real time, std::vector<Column> && columns);
+
+  /**
+   * Compress and append a block to the file
+   * @return An error message, empty when the block was written
+   */
+  std::string appendBlock(const std::string & table, Real time, const std::vector<Column> & columns);
+
+  /**
+   * Open the file (processor 0 only) the first time something is written
+   * @return false if the file could not be opened
+   */
+  bool openFile();
+
+  /**
+   * Index the blocks written before the checkpoint that is recovered and remove the rest of the
+   * file, so that the new blocks are appended after them
+   */
+  void recoverFile();
+
+  /// Number of postprocessor rows collected before they are written as a block
+  const unsigned int _rows_per_block;
+
+  /// Whether or not to compress blocks (when zlib is available)
+  const bool _compress;
+
+  /// True until the file of the recovered run has been prepared for appending
+  bool _recovering;
+
+  /// The output file (only open on processor 0, used by the writer)
+  std::fstream _file;
+
+  /// Number of blocks written (processor 0 only)
+  unsigned int & _num_blocks;
+
+  /// Times of the buffered postprocessor rows
+  std::vector<Real> & _row_times;
+
+  /// Time steps of the buffered postprocessor rows
+  std::vector<long long> & _row_timesteps;
+
+  /// Values of the buffered postprocessor rows by name (0 for rows where a value is missing)
+  std::map<std::string, std::vector<Real> > & _row_values;
+
+  /// Offset, time and table name of every block written so far (used by the writer)
+  std::vector<std::tuple<uint64_t, Real, std::string> > _block_index;
+};
+
+#endif /* BINARYTABLE_H */
@@ -43,6 +43,11 @@ public:
    */
   CSV(const InputParameters & parameters);
 
+  /**
+   * Finishes the asynchronous writes (they use the copies of the tables owned by this object)
+   */
+  virtual ~CSV();
+
 protected:
 
   /**
@@ -79,6 +84,17 @@ protected:
 
 private:
 
+  /**
+   * Write a table that grows one row per output (postprocessors, VectorPostprocessor times) to a file.
+   * When writing asynchronously the writer keeps its own copy of the table that only the newest row
+   * is handed over to.
+   * @param table The table to write
+   * @param async_table The copy of the table used by the writer (created by the first call)
+   * @param file_name The name of the file
+   * @param align Whether or not to align the columns
+   */
+  void writeRows(FormattedTable & table, std::unique_ptr<FormattedTable> & async_table, const std::string & file_name, bool align);
+
   /// Flag for aligning data in .csv file
   bool _align;
 
@@ -94,6 +110,12 @@ private:
 
   /// Flag for writting vector postprocessor data
   bool _write_vector_table;
+
+  /// Copy of _all_data_table written by the background writer ('asynchronous = true' only)
+  std::unique_ptr<FormattedTable> _async_all_data_table;
+
+  /// Copies of _vector_postprocessor_time_tables written by the background writer
+  std::map<std::string, std::unique_ptr<FormattedTable> > _async_vector_postprocessor_time_tables;
 };
 
 #endif /* CSV_H */
@@ -21,6 +21,7 @@
 #include "RestartableDataIO.h"
 
 #include <deque>
+#include <map>
 
 // Forward declarations
 class Checkpoint;
@@ -37,11 +38,17 @@ struct CheckpointFileNames
   /// Filename for CheckpointIO file
   std::string checkpoint;
 
-  /// Filename for EquationsSystems::write
+  /// Filename for EquationsSystems::write (empty once the files are removed)
   std::string system;
 
   /// Filename for restartable data filename
   std::string restart;
+
+  /// Filename listing the checkpoints an incremental checkpoint depends on (empty for a full checkpoint)
+  std::string chain;
+
+  /// True if the checkpoint holds the mesh and all of the restartable data
+  bool full = true;
 };
 
 /**
@@ -57,6 +64,11 @@ public:
    */
   Checkpoint(const InputParameters & parameters);
 
+  /**
+   * Finishes the asynchronous writes
+   */
+  virtual ~Checkpoint();
+
   /**
    * Outputs a checkpoint file.
    * Each call to this function creates various files associated with
@@ -74,9 +86,25 @@ public:
    */
   std::string directory();
 
+  /**
+   * The next incremental checkpoint is a full one when the mesh changes
+   */
+  virtual void meshChanged() override;
+
 protected:
 
-  void updateCheckpointFiles(CheckpointFileNames file_struct);
+  /**
+   * Add a checkpoint to the list of stored files and remove the ones that are no longer needed
+   * @return The errors of the file removals, empty when there were none (this may run on the
+   *         writer thread, so the caller reports them)
+   */
+  std::string updateCheckpointFiles(CheckpointFileNames file_struct);
+
+  /**
+   * Remove the system files (xdr) of a checkpoint and clear their name
+   * @param errors Stream collecting the errors of the removals
+   */
+  void removeSystemFiles(CheckpointFileNames & file_struct, std::ostream & errors);
 
 private:
 
@@ -107,8 +135,23 @@ private:
   /// RestrableData input/output interface
   RestartableDataIO _restartable_data_io;
 
-  /// Vector of checkpoint filename structures
+  /// Vector of checkpoint filename structures (used by the background writer when asynchronous)
   std::deque<CheckpointFileNames> _file_names;
+
+  /// True if only the solution and the changed restartable data are written between full checkpoints
+  bool _incremental;
+
+  /// Number of checkpoints in the chain of a full checkpoint and its incremental checkpoints
+  unsigned int _full_interval;
+
+  /// True if the mesh changed since the last full checkpoint
+  bool _mesh_changed;
+
+  /// The names (relative to the checkpoint directory) of the checkpoints since the last full one
+  std::vector<std::string> _chain;
+
+  /// Hashes of the restartable data written since the last full checkpoint
+  std::vector<std::map<std::string, std::size_t> > _data_hashes;
 };
 
 #endif //CHECKPOINT_H
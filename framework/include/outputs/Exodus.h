@@ -79,6 +79,12 @@ public:
    */
   virtual void sequence(bool state);
 
+  /**
+   * Continue writing to the existing ExodusII file with the next output, as is done when recovering.
+   * Used when an App is restored from a Backup taken on another processor.
+   */
+  void appendToExistingFile();
+
 protected:
 
   /**
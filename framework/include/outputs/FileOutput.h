@@ -18,8 +18,13 @@
 // MOOSE includes
 #include "PetscOutput.h"
 
+// C++ includes
+#include <functional>
+#include <memory>
+
 // Forward declerations
 class FileOutput;
+class AsyncOutputWriter;
 
 template<>
 InputParameters validParams<FileOutput>();
@@ -38,6 +43,14 @@ public:
    */
   FileOutput(const InputParameters & parameters);
 
+  /**
+   * Class destructor
+   *
+   * Objects that queue asynchronous writes using their own members must call waitForWrites() in
+   * their destructor, the queued writes are finished here otherwise.
+   */
+  virtual ~FileOutput();
+
   /**
    * The filename for the output file
    * @return A string of output file including the extension, by default this returns _file_base
@@ -71,6 +84,12 @@ public:
    */
   static std::string getOutputFileBase(MooseApp & app, std::string suffix = "_out");
 
+  /**
+   * Adds the 'asynchronous' parameters to the validParams of objects that support writing their
+   * files on a background thread (i.e. that use queueWrite())
+   */
+  static InputParameters enableAsynchronousOutput();
+
 protected:
 
   /**
@@ -85,6 +104,23 @@ protected:
    */
   bool checkFilename();
 
+  /**
+   * Write files on the background thread when 'asynchronous = true', otherwise write them now
+   * @param job Function doing the writing, it must only use a snapshot of the data to output
+   *            and returns an error message, empty on success (see AsyncOutputWriter)
+   */
+  void queueWrite(std::function<std::string()> job);
+
+  /**
+   * Block until all the queued writes are finished
+   */
+  void waitForWrites();
+
+  /**
+   * Whether or not files are written on a background thread
+   */
+  bool asynchronous() const { return _async_writer != nullptr; }
+
   /// The base filename from the input paramaters
   std::string _file_base;
 
@@ -98,6 +134,8 @@ protected:
   std::vector<std::string> _output_if_base_contains;
 
 private:
+  /// The background writer ('asynchronous = true' only)
+  std::unique_ptr<AsyncOutputWriter> _async_writer;
 
   // OutputWarehouse needs access to _file_num for MultiApp ninja wizardry (see OutputWarehouse::merge)
   friend class OutputWarehouse;
@@ -0,0 +1,175 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef PARALLELEXODUS_H
+#define PARALLELEXODUS_H
+
+// MOOSE includes
+#include "AdvancedOutput.h"
+#include "FileOutput.h"
+
+// C++ includes
+#include <unordered_map>
+
+// Forward declarations
+class ParallelExodus;
+
+template<>
+InputParameters validParams<ParallelExodus>();
+
+/**
+ * Writes a single ExodusII file without gathering the mesh and solution on one processor.
+ *
+ * The processors are split into contiguous groups, each with an aggregator (the first processor
+ * of the group) that collects the nodes, elements and values owned by the group and writes them
+ * into their slice of the file with the partial ExodusII API.  Nodes are numbered in the file by
+ * owning processor and the elements of each block by processor, so every slice is contiguous.
+ * The aggregators write one after another, the memory needed by an aggregator is bounded by the
+ * size of its group rather than the size of the problem.
+ *
+ * Only LAGRANGE nodal variables (with a degree of freedom on every node of the mesh) and
+ * CONSTANT MONOMIAL elemental variables are supported; each block must hold a single type of
+ * element.
+ */
+class ParallelExodus : public AdvancedOutput<FileOutput>
+{
+public:
+  ParallelExodus(const InputParameters & parameters);
+
+  /**
+   * Checks the variables that are going to be written
+   */
+  virtual void initialSetup() override;
+
+  /**
+   * A new file (with the next -s suffix) is started when the mesh changes
+   */
+  virtual void meshChanged() override;
+
+  virtual std::string filename() override;
+
+protected:
+  virtual void output(const ExecFlagType & type) override;
+
+  /// The nodal and elemental variables are written by output()
+  virtual void outputNodalVariables() override {}
+  virtual void outputElementalVariables() override {}
+
+  virtual void outputPostprocessors() override;
+
+  virtual void outputScalarVariables() override;
+
+private:
+  /**
+   * Number the owned nodes and local elements in the file and determine the slices of every processor
+   */
+  void buildLayout();
+
+  /**
+   * The coordinates of the owned nodes (x, y, z of every node)
+   */
+  void nodeCoordinates(std::vector<Real> & coords);
+
+  /**
+   * The (1-based) file node numbers of the local elements of each block, in ExodusII node order
+   */
+  void connectivity(std::vector<dof_id_type> & conn);
+
+  /**
+   * The values of the nodal variables at the owned nodes (one variable after another)
+   */
+  void nodalValues(std::vector<Real> & values);
+
+  /**
+   * The values of the elemental variables on the local elements (by variable, then block)
+   */
+  void elementalValues(std::vector<Real> & values);
+
+  /**
+   * Collect the data of the processors of the group on the aggregator (a no-op for a group of one)
+   * @param data The data of this processor, replaced by the data of the whole group on the aggregator
+   * @param sizes The number of entries contributed by every processor, per segment
+   * @param n_segments The data is made of segments (e.g. variables), the segments of all the
+   *                   processors are concatenated segment by segment
+   */
+  template<typename T>
+  void gatherGroup(std::vector<T> & data, const std::vector<dof_id_type> & sizes, unsigned int n_segments);
+
+  /**
+   * Write the data of the group (aggregators only)
+   */
+  void writeGroup(bool new_file,
+                  const std::vector<Real> & coords,
+                  const std::vector<dof_id_type> & conn,
+                  const std::vector<Real> & nodal_values,
+                  const std::vector<Real> & elemental_values);
+
+  /// Number of processors in each group
+  processor_id_type _group_size;
+
+  /// The first processor of this processor's group (the one that writes)
+  processor_id_type _aggregator;
+
+  /// The last processor (plus one) of this processor's group
+  processor_id_type _group_end;
+
+  /// Whether or not the file layout is up to date with the mesh
+  bool _layout_valid;
+
+  /// The current output file number
+  unsigned int _file_num;
+
+  /// The number of the next time step in the current file
+  unsigned int _exodus_num;
+
+  /// Dimension written to the file
+  unsigned int _num_dim;
+
+  /// The nodes owned by this processor in file order
+  std::vector<const Node *> _owned_nodes;
+
+  /// 0-based file number of every node used by the local elements
+  std::unordered_map<dof_id_type, dof_id_type> _node_file_ids;
+
+  /// The subdomain ids of the blocks
+  std::vector<SubdomainID> _block_ids;
+
+  /// The element type of each block
+  std::vector<ElemType> _block_types;
+
+  /// The number of nodes of the elements of each block
+  std::vector<unsigned int> _block_nodes;
+
+  /// The local elements of each block
+  std::vector<std::vector<const Elem *> > _block_elems;
+
+  /// Number of owned nodes on each processor
+  std::vector<dof_id_type> _node_counts;
+
+  /// Number of elements of each block (processor major) on each processor
+  std::vector<dof_id_type> _elem_counts;
+
+  /// The names of the nodal and elemental variables in the current file
+  std::vector<std::string> _nodal_names;
+  std::vector<std::string> _elemental_names;
+
+  /// The global (postprocessor and scalar) names and values of the current output
+  std::vector<std::string> _global_names;
+  std::vector<Real> _global_values;
+
+  /// The global names written to the current file
+  std::vector<std::string> _file_global_names;
+};
+
+#endif /* PARALLELEXODUS_H */
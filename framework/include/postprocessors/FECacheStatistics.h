@@ -0,0 +1,56 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+#ifndef FECACHESTATISTICS_H
+#define FECACHESTATISTICS_H
+
+#include "GeneralPostprocessor.h"
+
+//Forward Declarations
+class FECacheStatistics;
+
+template<>
+InputParameters validParams<FECacheStatistics>();
+
+/**
+ * Reports the usage of the FE shape function cache (see the 'fe_cache' parameter of the Problem block)
+ * summed over all threads and processors.
+ */
+class FECacheStatistics : public GeneralPostprocessor
+{
+public:
+  FECacheStatistics(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+
+  virtual Real getValue() override;
+
+  enum StatisticType
+  {
+    HIT_RATE,
+    HITS,
+    MISSES,
+    BYTES,
+    ENTRIES
+  };
+
+protected:
+  /// The statistic to report
+  const StatisticType _statistic;
+
+  /// The value computed in execute()
+  Real _value;
+};
+
+#endif // FECACHESTATISTICS_H
@@ -15,13 +15,16 @@
 #ifndef BACKUP_H
 #define BACKUP_H
 
+// MOOSE includes
+#include "MooseTypes.h"
+
 // C++ includes
 #include <sstream>
 #include <list>
 #include <vector>
 
 /**
- * Helper class to hold streams for Backup and Restore operations.
+ * Helper class to hold the data for Backup and Restore operations.
  */
 class Backup
 {
@@ -30,7 +33,8 @@ public:
 
   ~Backup();
 
-  std::stringstream _system_data;
+  /// The local entries of the solution and every other vector of the nonlinear and then the auxiliary system, one after the other
+  std::vector<Real> _system_data;
 
   std::vector<std::stringstream*> _restartable_data;
 };
@@ -616,11 +616,14 @@ loadHelper(std::istream & stream, HashMap<P,Q> & data, void * context)
 }
 
 // Specializations for Backup type
+// The system data is written as a block of bytes (size first) so the format matches that of a stringstream
 template<>
 inline void
 dataStore(std::ostream & stream, Backup * & backup, void * context)
 {
-  dataStore(stream, backup->_system_data, context);
+  size_t s_size = backup->_system_data.size() * sizeof(Real);
+  stream.write((char *) &s_size, sizeof(s_size));
+  stream.write((char *) backup->_system_data.data(), s_size);
 
   for (unsigned int i=0; i<backup->_restartable_data.size(); i++)
     dataStore(stream, backup->_restartable_data[i], context);
@@ -630,7 +633,10 @@ template<>
 inline void
 dataLoad(std::istream & stream, Backup * & backup, void * context)
 {
-  dataLoad(stream, backup->_system_data, context);
+  size_t s_size = 0;
+  stream.read((char *) &s_size, sizeof(s_size));
+  backup->_system_data.resize(s_size / sizeof(Real));
+  stream.read((char *) backup->_system_data.data(), s_size);
 
   for (unsigned int i=0; i<backup->_restartable_data.size(); i++)
     dataLoad(stream, backup->_restartable_data[i], context);
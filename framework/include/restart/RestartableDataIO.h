@@ -23,11 +23,14 @@
 #include <sstream>
 #include <string>
 #include <list>
+#include <map>
+#include <vector>
 
 // Forward declarations
 class RestartableDatas;
 class RestartableDataValue;
 class FEProblemBase;
+class SystemBase;
 
 /**
  * Class for doing restart.
@@ -46,6 +49,30 @@ public:
    */
   void writeRestartableData(std::string base_file_name, const RestartableDatas & restartable_datas, std::set<std::string> & _recoverable_data);
 
+  /**
+   * Serialize the restartable data of every thread into a buffer per thread, to be written later
+   * by writeRestartableData(const std::string &, const std::vector<std::string> &).
+   */
+  void serializeRestartableData(const RestartableDatas & restartable_datas, std::vector<std::string> & thread_data);
+
+  /**
+   * Serialize the restartable data that changed since the previous call into a buffer per thread.
+   * Every entry is serialized and hashed, only the entries whose hash differs from the one in
+   * hashes are kept (all of them when hashes is empty).  The buffers are regular restartable data
+   * files holding a subset of the data, reading them after the previous files restores the data.
+   * @param hashes The hash of every entry of every thread, updated with the current hashes
+   */
+  void serializeChangedRestartableData(const RestartableDatas & restartable_datas, std::vector<std::map<std::string, std::size_t> > & hashes, std::vector<std::string> & thread_data);
+
+  /**
+   * Write restartable data serialized by serializeRestartableData() to the files that
+   * writeRestartableData() creates.  This only writes the files, so it may be called from the
+   * background output writer.  Each file is written under a temporary name and renamed once it is
+   * complete.
+   * @return false if a file could not be written
+   */
+  bool writeRestartableData(const std::string & base_file_name, const std::vector<std::string> & thread_data) const;
+
   /**
    * Read restartable data header to verify that we are restarting on the correct number of processors and threads.
    */
@@ -58,8 +85,10 @@ public:
 
   /**
    * Create a Backup for the current system.
+   *
+   * @param backup An existing Backup to fill in, reusing its buffers.  A new Backup is created if this is NULL.
    */
-  MooseSharedPointer<Backup> createBackup();
+  MooseSharedPointer<Backup> createBackup(MooseSharedPointer<Backup> backup = MooseSharedPointer<Backup>());
 
   /**
    * Restore a Backup for the current system.
@@ -67,6 +96,16 @@ public:
   void restoreBackup(MooseSharedPointer<Backup> backup, bool for_restart = false);
 
 private:
+  /**
+   * The name of the restartable data file of this processor for thread tid
+   */
+  std::string restartableDataFileName(const std::string & base_file_name, THREAD_ID tid, unsigned int n_threads) const;
+
+  /**
+   * Writes the header of a restartable data file (and the names of the data it holds) into the stream object.
+   */
+  void serializeRestartableDataHeader(const std::vector<std::string> & data_names, std::ostream & stream);
+
   /**
    * Serializes the data into the stream object.
    */
@@ -78,14 +117,25 @@ private:
   void deserializeRestartableData(const std::map<std::string, RestartableDataValue *> & restartable_data, std::istream & stream, const std::set<std::string> & recoverable_data);
 
   /**
-   * Serializes the data for the Systems in FEProblemBase
+   * Copies the local entries of the vectors of the Systems in FEProblemBase into data
+   */
+  void serializeSystems(std::vector<Real> & data);
+
+  /**
+   * Copies data back into the vectors of the Systems in FEProblemBase
+   */
+  void deserializeSystems(const std::vector<Real> & data);
+
+  /**
+   * Appends the local entries of the solution and the other vectors of a system to data
    */
-  void serializeSystems(std::ostream & stream);
+  void serializeSystem(SystemBase & system_base, std::vector<Real> & data);
 
   /**
-   * Deserializes the data for the Systems in FEProblemBase
+   * Sets the local entries of the solution and the other vectors of a system from data
+   * starting at offset.  offset is advanced past the values that were used.
    */
-  void deserializeSystems(std::istream & stream);
+  void deserializeSystem(SystemBase & system_base, const std::vector<Real> & data, std::size_t & offset);
 
   /// Reference to a FEProblemBase being restarted
   FEProblemBase & _fe_problem;
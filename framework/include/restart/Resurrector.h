@@ -20,6 +20,7 @@
 
 // C++ includes
 #include <string>
+#include <vector>
 
 // Forward declarations
 class FEProblemBase;
@@ -56,6 +57,9 @@ protected:
   /// name of the file that we restart from
   std::string _restart_file_base;
 
+  /// The checkpoints holding the restartable data of the restart file, oldest first
+  std::vector<std::string> _restart_chain;
+
   /// Restartable Data
   RestartableDataIO _restartable;
 
@@ -37,6 +37,8 @@ public:
 
   virtual void execute() override;
 
+  virtual void appsMoved() override;
+
 protected:
   /**
    * Return the nearest node to the point p.
@@ -48,6 +50,20 @@ protected:
    */
   Node * getNearestNode(const Point & p, Real & distance, const MeshBase::const_node_iterator & nodes_begin, const MeshBase::const_node_iterator & nodes_end);
 
+  /**
+   * Store the source points and weights that interpolate to a target dof.
+   * @param i_to The target (the global app index for TO_MULTIAPP, zero for FROM_MULTIAPP)
+   * @param dof The target dof
+   * @param src_indices Indices of the contributing points into the gathered source points
+   * @param weights The normalized inverse distance weights of the contributing points
+   */
+  void cacheWeights(unsigned int i_to, dof_id_type dof, const std::vector<std::size_t> & src_indices, const std::vector<Real> & weights);
+
+  /**
+   * Set the cached target dofs of target i_to from the gathered source values.
+   */
+  void applyCachedWeights(unsigned int i_to, const std::vector<Number> & src_vals, NumericVector<Number> & solution);
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
 
@@ -55,6 +71,24 @@ protected:
   Real _power;
   MooseEnum _interp_type;
   Real _radius;
+
+  /// If true then the nearest source points and their weights are computed once and reused
+  bool _fixed_meshes;
+
+  /// Whether the cached data below is valid
+  bool _weights_cached;
+
+  /// The target dofs of each target
+  std::vector<std::vector<dof_id_type> > _cached_dofs;
+
+  /// Offsets of each target dof into _cached_src_indices and _cached_weights
+  std::vector<std::vector<unsigned int> > _cached_offsets;
+
+  /// Indices into the gathered source values that contribute to each target dof
+  std::vector<std::vector<std::size_t> > _cached_src_indices;
+
+  /// The weights multiplying the source values in _cached_src_indices
+  std::vector<std::vector<Real> > _cached_weights;
 };
 
 #endif /* MULTIAPPINTERPOLATIONTRANSFER_H */
@@ -38,10 +38,43 @@ public:
 
   virtual void execute() override;
 
+  virtual void appsMoved() override;
+
 protected:
+  /**
+   * Locate the points requested by processor i_proc in the local "from" apps and store the
+   * source app, dofs and shape function values that evaluate the source variable at each of them.
+   * @param i_proc The processor that requested the points
+   * @param incoming_points The requested points
+   * @param local_bboxes The bounding boxes of the local "from" apps
+   */
+  void cacheSourceWeights(processor_id_type i_proc, const std::vector<Point> & incoming_points,
+                          const std::vector<MeshTools::BoundingBox> & local_bboxes);
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
   bool _error_on_miss;
+
+  /// If true then the point locations and interpolation weights are computed once and reused
+  bool _fixed_meshes;
+
+  /// Whether the cached data below is valid
+  bool _weights_cached;
+
+  /// The points this processor requested from each processor on the first execution
+  std::vector<std::map<std::pair<unsigned int, unsigned int>, unsigned int> > _cached_point_index_map;
+
+  /// The local "from" app of each point requested by each processor (invalid_uint if it was not found)
+  std::vector<std::vector<unsigned int> > _cached_froms;
+
+  /// Offsets of each point requested by each processor into _cached_dofs and _cached_weights
+  std::vector<std::vector<unsigned int> > _cached_offsets;
+
+  /// The source dofs that contribute to each point requested by each processor
+  std::vector<std::vector<dof_id_type> > _cached_dofs;
+
+  /// The shape function values multiplying _cached_dofs
+  std::vector<std::vector<Real> > _cached_weights;
 };
 
 #endif /* MULTIAPPMESHFUNCTIONTRANSFER_H */
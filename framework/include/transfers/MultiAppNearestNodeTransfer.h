@@ -37,6 +37,8 @@ public:
 
   virtual void execute() override;
 
+  virtual void appsMoved() override;
+
 protected:
   /**
    * Return the nearest node to the point p.
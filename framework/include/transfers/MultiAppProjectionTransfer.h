@@ -34,6 +34,8 @@ public:
 
   virtual void execute() override;
 
+  virtual void appsMoved() override;
+
 protected:
   void toMultiApp();
   void fromMultiApp();
@@ -42,6 +44,21 @@ protected:
 
   void projectSolution(unsigned int to_problem);
 
+  /**
+   * Add the projection system to every "to" problem that does not have it yet.
+   */
+  void setupProjectionSystems();
+
+  /**
+   * Locate the quadrature points requested by processor i_proc in the local "from" apps and store
+   * the source app, dofs and shape function values that evaluate the source variable at each of them.
+   * @param i_proc The processor that requested the quadrature points
+   * @param incoming_qps The requested quadrature points
+   * @param local_bboxes The bounding boxes of the local "from" apps
+   */
+  void cacheSourceWeights(processor_id_type i_proc, const std::vector<Point> & incoming_qps,
+                          const std::vector<MeshTools::BoundingBox> & local_bboxes);
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
 
@@ -49,6 +66,9 @@ protected:
 
   /// True, if we need to recompute the projection matrix
   bool _compute_matrix;
+
+  /// True, if Apps moved and the "to" problems need to be checked for their projection system
+  bool _setup_proj_sys;
   std::vector<LinearImplicitSystem *> _proj_sys;
   /// Having one projection variable number seems weird, but there is always one variable in every system being used for projection,
   /// thus is always going to be 0 unless something changes in libMesh or we change the way we project variables
@@ -56,12 +76,23 @@ protected:
 
   friend void assemble_l2(EquationSystems & es, const std::string & system_name);
 
-  // These variables allow us to cache qps for fixed meshes.
+  // These variables allow us to cache qps, their source weights and the projection matrix for fixed meshes.
   bool _fixed_meshes;
   bool _qps_cached;
-  std::vector<std::vector<Point> > _cached_qps;
   std::vector<std::map<std::pair<unsigned int, unsigned int>, unsigned int> > _cached_index_map;
 
+  /// The local "from" app of each qp requested by each processor (invalid_uint if it was not found)
+  std::vector<std::vector<unsigned int> > _cached_froms;
+
+  /// Offsets of each qp requested by each processor into _cached_dofs and _cached_weights
+  std::vector<std::vector<unsigned int> > _cached_offsets;
+
+  /// The source dofs that contribute to each qp requested by each processor
+  std::vector<std::vector<dof_id_type> > _cached_dofs;
+
+  /// The shape function values multiplying _cached_dofs
+  std::vector<std::vector<Real> > _cached_weights;
+
 };
 
 
@@ -67,6 +67,12 @@ public:
   /// Return the execution flags, handling "same_as_multiapp"
   virtual const std::vector<ExecFlagType> & execFlags() const;
 
+  /**
+   * Called by the MultiApp after its Apps changed processors.  Transfers that cache data depending
+   * on which processor owns which App must discard it here.
+   */
+  virtual void appsMoved() {}
+
 protected:
   /// The MultiApp this Transfer is transferring data to or from
   MooseSharedPointer<MultiApp> _multi_app;
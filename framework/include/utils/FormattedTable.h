@@ -58,6 +58,12 @@ public:
    */
   void addData(const std::string & name, Real value, Real time);
 
+  /**
+   * Add the row of another table that was added to last (i.e. the values at the time of its
+   * last addData() call).  Used to keep a copy of a table up to date one row at a time.
+   */
+  void addLastRow(const FormattedTable & other);
+
   /**
    * Retrieve Data for last value of given name
    */
@@ -70,8 +76,6 @@ public:
    */
   void outputTimeColumn(bool output_time) { _output_time = output_time; }
 
-  const std::map<Real, std::map<std::string, Real> > & getData() const { return _data; }
-
   /**
    * Methods for dumping the table to the stream - either by filename or by stream handle.  If
    * a filename is supplied opening and closing of the file is properly handled.  In the
@@ -85,7 +89,9 @@ public:
   void printTable(const std::string & file_name);
 
   /**
-   * Method for dumping the table to a csv file - opening and closing the file handle is handled
+   * Method for dumping the table to a csv file - opening and closing the file handle is handled.
+   * If only new rows were added since the last call to the same file they are appended,
+   * otherwise the whole file is rewritten.
    *
    * Note: Only call this on processor 0!
    */
@@ -129,10 +135,12 @@ protected:
 
   /**
    * Data structure for the console table
-   * The first map creates an association from the independent variable (normally time)
-   * to a map of dependent variables and their associated values if they exist
+   * The values of the independent variable (normally time) for every row, sorted
    */
-  std::map<Real, std::map<std::string, Real> > _data;
+  std::vector<Real> _row_keys;
+
+  /// The values of each dependent variable for every row (0 for rows where no value was added)
+  std::map<std::string, std::vector<Real> > _columns;
 
   /// The set of column names updated when data is inserted through the setter methods
   std::set<std::string> _column_names;
@@ -154,6 +162,19 @@ protected:
   /// Whether or not to output the Time column
   bool _output_time;
 
+  /// The number of rows in the csv file that are still up to date (0 if the file has to be rewritten)
+  std::size_t _csv_rows_written;
+
+  /// The position in the csv file after the last row written
+  std::streampos _csv_end_pos;
+
+  /// The interval and alignment the csv file was written with
+  int _csv_interval;
+  bool _csv_align;
+
+  /// The column widths of the aligned csv file
+  std::map<std::string, unsigned int> _csv_widths;
+
 private:
 
   /// *.csv file delimiter, defaults to ","
@@ -0,0 +1,106 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef KDTREE_H
+#define KDTREE_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+
+// libMesh includes
+#include "libmesh/point.h"
+
+// System includes
+#include <vector>
+
+/**
+ * A k-d tree over a fixed set of points supporting k-nearest neighbor queries.
+ *
+ * The tree is built once in O(N log N) by splitting the points at the median
+ * along the direction of their largest extent. Queries do not modify the tree,
+ * so several threads can search the same tree concurrently.
+ */
+class KDTree
+{
+public:
+  /**
+   * Build the tree
+   * @param points The points to search (copied)
+   * @param max_leaf_size The maximum number of points stored in a leaf
+   */
+  KDTree(const std::vector<Point> & points, unsigned int max_leaf_size = 10);
+
+  /**
+   * Find the points closest to a query point
+   * @param query_point The point to search around
+   * @param patch_size The number of points to return (fewer if the tree holds fewer points)
+   * @param return_index Filled with the indices of the closest points, nearest first
+   */
+  void neighborSearch(const Point & query_point, unsigned int patch_size, std::vector<std::size_t> & return_index) const;
+
+  /**
+   * Find the points closest to a query point and their squared distances
+   * @param query_point The point to search around
+   * @param patch_size The number of points to return (fewer if the tree holds fewer points)
+   * @param return_index Filled with the indices of the closest points, nearest first
+   * @param return_dist_sqr Filled with the squared distances of the returned points
+   */
+  void neighborSearch(const Point & query_point, unsigned int patch_size, std::vector<std::size_t> & return_index,
+                      std::vector<Real> & return_dist_sqr) const;
+
+  /**
+   * Number of points in the tree
+   */
+  std::size_t size() const { return _points.size(); }
+
+protected:
+  /// A tree node: either a leaf holding a range of _index or a split with two children
+  struct TreeNode
+  {
+    /// The range of _index covered by this node
+    std::size_t begin;
+    std::size_t end;
+
+    /// The splitting direction and coordinate (only valid for non-leaf nodes)
+    unsigned int dim;
+    Real split;
+
+    /// The children in _nodes (both zero for leaves; the root is never a child)
+    std::size_t left;
+    std::size_t right;
+  };
+
+  /// (squared distance, point index) pairs ordered such that the furthest one is on top of a heap
+  typedef std::pair<Real, std::size_t> Candidate;
+
+  /// Recursively build the subtree over _index[begin, end) and return its position in _nodes
+  std::size_t build(std::size_t begin, std::size_t end);
+
+  /// Recursively collect the patch_size closest points of a subtree in the heap of candidates
+  void search(std::size_t node, const Point & query_point, unsigned int patch_size, std::vector<Candidate> & candidates) const;
+
+  /// The points
+  const std::vector<Point> _points;
+
+  /// Indices into _points ordered such that every tree node covers a contiguous range
+  std::vector<std::size_t> _index;
+
+  /// The tree nodes, the root is _nodes[0]
+  std::vector<TreeNode> _nodes;
+
+  /// Maximum number of points in a leaf
+  const unsigned int _max_leaf_size;
+};
+
+#endif // KDTREE_H
@@ -166,6 +166,15 @@ public:
    */
   void shallowCopy(std::vector<T> & rhs);
 
+  /**
+   * Doesn't actually make a copy of the data.
+   *
+   * Just makes _this_ object operate on n entries of rhs starting at offset.
+   * The same warnings as for shallowCopy() apply, in addition _this_ object
+   * must not be resized past n entries while it points into rhs.
+   */
+  void shallowCopy(const MooseArray & rhs, unsigned int offset, unsigned int n);
+
   /**
    * Actual operator=... really does make a copy of the data
    *
@@ -321,6 +330,17 @@ MooseArray<T>::shallowCopy(std::vector<T> & rhs)
   _allocated_size = rhs.size();
 }
 
+template<typename T>
+inline
+void
+MooseArray<T>::shallowCopy(const MooseArray & rhs, unsigned int offset, unsigned int n)
+{
+  mooseAssert(offset + n <= rhs._size, "Shallow copy out of bounds in MooseArray (offset: " << offset << " n: " << n << " size: " << rhs._size << ")");
+  _data = rhs._data + offset;
+  _size = n;
+  _allocated_size = n;
+}
+
 template<typename T>
 inline
 MooseArray<T> &
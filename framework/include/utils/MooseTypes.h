@@ -176,6 +176,16 @@ enum CouplingType
   COUPLING_CUSTOM
 };
 
+/**
+ * How threads add their element contributions to the global residual and Jacobian
+ */
+enum ThreadedAssemblyType
+{
+  TA_LOCKED,
+  TA_COLORED,
+  TA_THREAD_LOCAL
+};
+
 enum ConstraintSideType
 {
   SIDE_MASTER,
@@ -236,7 +246,8 @@ enum SolveType
   ST_JFNK,             ///< Jacobian-Free Newton Krylov
   ST_NEWTON,           ///< Full Newton Solve
   ST_FD,               ///< Use finite differences to compute Jacobian
-  ST_LINEAR            ///< Solving a linear problem
+  ST_LINEAR,           ///< Solving a linear problem
+  ST_MATRIX_FREE       ///< Newton Krylov applying the analytic Jacobian element by element without storing it
 };
 
 /**
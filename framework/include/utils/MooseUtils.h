@@ -277,10 +277,24 @@ namespace MooseUtils
 
   /**
    * Returns the most recent checkpoint file given a list of files.
+   * Checkpoints that don't have their system file (.xdr) or the restartable data files of every
+   * processor and thread are skipped, the restartable data files are the last ones a checkpoint
+   * writes. Since that checks the files of every processor, a parallel run should only call
+   * this on one processor and broadcast the result.
    * If a suitable file isn't found the empty string is returned
    * @param checkpoint_files the list of files to analyze
+   * @param n_processors The number of processors of the run
+   * @param n_threads The number of threads of the run
    */
-  std::string getRecoveryFileBase(const std::list<std::string> & checkpoint_files);
+  std::string getRecoveryFileBase(const std::list<std::string> & checkpoint_files, unsigned int n_processors, unsigned int n_threads);
+
+  /**
+   * Returns the checkpoints needed to recover from the given checkpoint, oldest first.
+   * An incremental checkpoint lists them in its ".chain" file, starting with the full checkpoint
+   * that holds its mesh; any other checkpoint only needs itself and must have a mesh file.
+   * @param file_base The base name of the checkpoint files (e.g. "out_cp/0010")
+   */
+  std::vector<std::string> getCheckpointChain(const std::string & file_base);
 
 
   /**
@@ -0,0 +1,47 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ELEMENTLOOPTHREADTIMES_H
+#define ELEMENTLOOPTHREADTIMES_H
+
+#include "GeneralVectorPostprocessor.h"
+
+//Forward Declarations
+class ElementLoopThreadTimes;
+
+template<>
+InputParameters validParams<ElementLoopThreadTimes>();
+
+/**
+ * Reports the time each thread spent on elements during the last residual or
+ * Jacobian evaluation (requires Executioner/element_scheduler = cost).
+ * Values are the maximum over all processors.
+ */
+class ElementLoopThreadTimes : public GeneralVectorPostprocessor
+{
+public:
+  ElementLoopThreadTimes(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+
+protected:
+  /// Thread ids
+  VectorPostprocessorValue & _thread;
+
+  /// Seconds spent by each thread
+  VectorPostprocessorValue & _time;
+};
+
+#endif
@@ -24,6 +24,9 @@ class PrimaryDiffusion : public Diffusion
 public:
   PrimaryDiffusion(const InputParameters & parameters);
 
+  /// computeQpResidual() is overridden, so the Diffusion batch residual does not apply
+  virtual bool supportsBatch() const override { return false; }
+
 protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
@@ -83,6 +83,8 @@ public:
   bool shouldApply();
   void computeContactForce(PenetrationInfo * pinfo);
 
+  virtual bool supportsThreadedAssembly() const;
+
 protected:
 
   Real nodalArea(PenetrationInfo & pinfo);
@@ -101,6 +103,9 @@ protected:
   const Real _stick_unlock_factor;
   bool _update_contact_set;
 
+  /// The penetration info of the current slave node (found by shouldApply())
+  PenetrationInfo * _current_pinfo;
+
   NumericVector<Number> & _residual_copy;
 //  std::map<Point, PenetrationInfo *> _point_to_info;
 
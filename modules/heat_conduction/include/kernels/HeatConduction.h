@@ -28,6 +28,9 @@ public:
 
   HeatConductionKernel(const InputParameters & parameters);
 
+  virtual bool supportsBatch() const override;
+  virtual void storeBatchElement() override;
+
 protected:
   virtual Real computeQpResidual();
 
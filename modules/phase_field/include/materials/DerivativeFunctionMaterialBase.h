@@ -30,6 +30,10 @@ InputParameters validParams<DerivativeFunctionMaterialBase>();
  * A derived class needs to implement the computeF(), computeDF(),
  * computeD2F(), and (optionally) computeD3F() methods.
  *
+ * The second and third derivatives are marked as Jacobian-only properties, i.e.
+ * they are skipped in loops (such as residual evaluations) where all consumers
+ * retrieve them with getJacobianMaterialPropertyDerivative.
+ *
  * Note that DerivativeParsedMaterial provides a material for which a mathematical
  * free energy expression can be provided in the input file (with the
  * derivatives being calculated automatically).
@@ -96,6 +100,14 @@ protected:
 
   /// Material properties to store the third derivatives.
   std::vector<std::vector<std::vector<MaterialProperty<Real> *> > > _prop_d3F;
+
+  /// Ids of the second (index i*nargs+j) and third (index (i*nargs+j)*nargs+k) derivatives, which are Jacobian-only
+  std::vector<unsigned int> _d2F_ids;
+  std::vector<unsigned int> _d3F_ids;
+
+  /// Whether or not the second and third derivatives are needed on the current element
+  std::vector<bool> _compute_d2F;
+  std::vector<bool> _compute_d3F;
 };
 
 #endif //DERIVATIVEFUNCTIONMATERIALBASE_H
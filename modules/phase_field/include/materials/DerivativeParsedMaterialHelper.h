@@ -33,6 +33,9 @@ protected:
   void assembleDerivatives();
   MatPropDescriptorList::iterator findMatPropDerivative(const FunctionMaterialPropertyDescriptor &);
 
+  /// Look up the id of a declared derivative property, marking second and higher derivatives as Jacobian-only
+  unsigned int derivativePropertyId(const std::vector<VariableName> & darg_names);
+
   struct QueueItem;
   struct Derivative;
 
@@ -64,6 +67,12 @@ struct DerivativeParsedMaterialHelper::Derivative
   MaterialProperty<Real> * first;
   ADFunctionPtr second;
   std::vector<VariableName> darg_names;
+
+  /// id of the derivative property (second and higher derivatives are Jacobian-only)
+  unsigned int prop_id;
+
+  /// whether or not the derivative is needed on the current element
+  bool needed;
 };
 
 #endif // DERIVATIVEPARSEDMATERIALHELPER_H
@@ -18,6 +18,8 @@ class ComputeIsotropicElasticityTensor : public ComputeElasticityTensorBase
 public:
   ComputeIsotropicElasticityTensor(const InputParameters & parameters);
 
+  virtual void computeProperties();
+
 protected:
   virtual void computeQpElasticityTensor();
 
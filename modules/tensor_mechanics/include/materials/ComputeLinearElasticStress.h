@@ -17,10 +17,14 @@ class ComputeLinearElasticStress : public ComputeStressBase
 public:
   ComputeLinearElasticStress(const InputParameters & parameters);
   virtual void initialSetup();
+  virtual void computeProperties();
 
 protected:
   virtual void computeQpStress();
 
+  /// The stress, elastic strain and Jacobian at a quadrature point (used by both evaluation paths)
+  void computeLinearElasticStress(unsigned int qp);
+
   const MaterialProperty<RankTwoTensor> & _mechanical_strain;
 };
 
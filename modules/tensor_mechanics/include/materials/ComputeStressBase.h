@@ -26,6 +26,9 @@ protected:
   virtual void computeQpProperties();
   virtual void computeQpStress() = 0;
 
+  /// Add the extra stress at a quadrature point, done after computeQpStress()
+  void addExtraStress(unsigned int qp) { _stress[qp] += _extra_stress[qp]; }
+
   std::string _base_name;
 
   const MaterialProperty<RankTwoTensor> & _mechanical_strain;
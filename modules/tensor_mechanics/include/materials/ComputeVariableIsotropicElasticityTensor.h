@@ -20,6 +20,9 @@ class ComputeVariableIsotropicElasticityTensor : public ComputeIsotropicElastici
 public:
   ComputeVariableIsotropicElasticityTensor(const InputParameters & parameters);
 
+  /// The elastic constants vary in space, so the tensor is computed one quadrature point at a time
+  virtual void computeProperties() { Material::computeProperties(); }
+
 protected:
   virtual void initQpStatefulProperties();
   virtual void computeQpElasticityTensor();
@@ -0,0 +1,94 @@
+# Timing problem for the elasticity material stack.  The compute_residual() and
+# compute_jacobian() times are reported as postprocessors; running the input with
+# 'batch_qp = false' on both materials gives the times of the per qp path to compare with.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 30
+  ny = 30
+  nz = 30
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Modules/TensorMechanics/Master]
+  [./all]
+    strain = SMALL
+    add_variables = true
+  [../]
+[]
+
+[BCs]
+  [./bottom]
+    type = PresetBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  [../]
+  [./left]
+    type = PresetBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  [../]
+  [./back]
+    type = PresetBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  [../]
+  [./top]
+    type = PresetBC
+    variable = disp_y
+    boundary = top
+    value = 0.001
+  [../]
+[]
+
+[Materials]
+  [./stress]
+    type = ComputeLinearElasticStress
+  [../]
+  [./elasticity_tensor]
+    type = ComputeIsotropicElasticityTensor
+    poissons_ratio = 0.1
+    youngs_modulus = 1e6
+  [../]
+[]
+
+[Postprocessors]
+  [./residual_time]
+    type = PerformanceData
+    event = 'compute_residual()'
+  [../]
+  [./jacobian_time]
+    type = PerformanceData
+    event = 'compute_jacobian()'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+  l_tol = 1e-3
+  l_max_its = 300
+  nl_max_its = 10
+[]
+
+[Outputs]
+  print_perf_log = true
+  [./exodus]
+    type = Exodus
+    # The timings differ from run to run, they are only printed
+    hide = 'residual_time jacobian_time'
+  [../]
+[]
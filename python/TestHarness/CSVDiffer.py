@@ -1,7 +1,7 @@
 import os, re, math
 
 class CSVDiffer:
-  def __init__(self, test_dir, out_files, abs_zero=1e-11, relative_error=5.5e-6):
+  def __init__(self, test_dir, out_files, abs_zero=1e-11, relative_error=5.5e-6, gold_dir='gold'):
     self.abs_zero = float(abs_zero)
     self.rel_tol = float(relative_error)
     self.files = []
@@ -16,7 +16,7 @@ class CSVDiffer:
         self.msg += 'WARNING: Are you sure you want to use csv diff on a .e file?\n'
 
       test_filename = os.path.join(test_dir,out_file)
-      gold_filename = os.path.join(test_dir, 'gold', out_file)
+      gold_filename = os.path.join(test_dir, gold_dir, out_file)
       if not os.path.exists(test_filename):
         self.addError(test_filename, 'File does not exist!')
       elif not os.path.exists(gold_filename):
@@ -33,7 +33,7 @@ class CSVDiff(RunApp):
       return (reason, output)
 
     if len(specs['csvdiff']) > 0:
-      differ = CSVDiffer( specs['test_dir'], specs['csvdiff'], specs['abs_zero'], specs['rel_err'] )
+      differ = CSVDiffer( specs['test_dir'], specs['csvdiff'], specs['abs_zero'], specs['rel_err'], specs['gold_dir'] )
       msg = differ.diff()
       output += 'Running CSVDiffer.py\n' + msg
       if msg != '':
@@ -0,0 +1,213 @@
+#!/usr/bin/env python
+"""
+Reader for the files written by the BinaryTable output object (*.mtab).
+
+  binary_table.py file.mtab                       # list the tables
+  binary_table.py file.mtab -t postprocessors     # write a table as csv
+  binary_table.py file.mtab -t my_vpp -b -1       # write the last block of a table as csv
+  binary_table.py file.mtab -t my_vpp -c x u      # only write some of the columns
+
+Or from python:
+
+  from binary_table import BinaryTable
+  table = BinaryTable('file.mtab')
+  data = table.read('postprocessors')    # dict of column name -> list of values
+"""
+
+import argparse, struct, sys, zlib
+
+FILE_MAGIC = b'MOOSETAB'
+BLOCK_MAGIC = b'BLCK'
+INDEX_MAGIC = b'INDX'
+TRAILER_MAGIC = b'MTABINDX'
+TYPES = {b'd' : 'd', b'q' : 'q'}
+
+class BinaryTableError(Exception):
+  pass
+
+class BinaryTable(object):
+  """
+  Reads the block index of a BinaryTable file. The index written at the end of the file is used
+  when present, otherwise (e.g. the simulation is still running) the blocks are walked.
+  """
+  def __init__(self, filename):
+    self._file = open(filename, 'rb')
+    self._data = self._file.read()
+    self._file.close()
+
+    if self._data[:8] != FILE_MAGIC:
+      raise BinaryTableError('%s is not a BinaryTable file' % filename)
+    version = self._unpack('I', 8)[0]
+    if version != 1:
+      raise BinaryTableError('Unsupported BinaryTable version %d' % version)
+
+    # List of (offset, time, table) for every block
+    self.blocks = self._readIndex()
+    if self.blocks is None:
+      self.blocks = self._scanBlocks()
+
+  def tables(self):
+    """ The names of the tables in the file (in order of appearance) """
+    names = []
+    for block in self.blocks:
+      if block[2] not in names:
+        names.append(block[2])
+    return names
+
+  def readBlock(self, offset):
+    """ Returns the table name, time and the columns (list of (name, values)) of the block at offset """
+    if self._data[offset:offset + 4] != BLOCK_MAGIC:
+      raise BinaryTableError('No block at offset %d' % offset)
+    table, pos = self._readString(offset + 4)
+    time, compression, raw_size, stored_size = self._unpack('dBQQ', pos)
+    pos += struct.calcsize('=dBQQ')
+
+    payload = self._data[pos:pos + stored_size]
+    if len(payload) != stored_size:
+      raise BinaryTableError('Block at offset %d is truncated' % offset)
+    if compression == 1:
+      payload = zlib.decompress(payload)
+    elif compression != 0:
+      raise BinaryTableError('Unknown compression %d in block at offset %d' % (compression, offset))
+    if len(payload) != raw_size:
+      raise BinaryTableError('Block at offset %d has the wrong size' % offset)
+
+    columns = []
+    n_columns = struct.unpack_from('=I', payload, 0)[0]
+    pos = 4
+    for i in range(n_columns):
+      (length,) = struct.unpack_from('=I', payload, pos)
+      name = payload[pos + 4:pos + 4 + length].decode()
+      pos += 4 + length
+      type_code = payload[pos:pos + 1]
+      if type_code not in TYPES:
+        raise BinaryTableError('Unknown column type %r in block at offset %d' % (type_code, offset))
+      (count,) = struct.unpack_from('=Q', payload, pos + 1)
+      pos += 9
+      fmt = '=%d%s' % (count, TYPES[type_code])
+      columns.append((name, list(struct.unpack_from(fmt, payload, pos))))
+      pos += struct.calcsize(fmt)
+
+    return table, time, columns
+
+  def read(self, table, block=None):
+    """
+    Returns the columns of a table as a dict of name -> list of values.
+
+    The blocks of the postprocessor table are concatenated (values of columns missing from a block
+    are 0, a row repeating the time of the previous row replaces it) unless a block number is given.
+    VectorPostprocessor tables return the last block unless a block number is given. Negative block
+    numbers count from the end.
+    """
+    offsets = [b[0] for b in self.blocks if b[2] == table]
+    if not offsets:
+      raise BinaryTableError('No table named %s' % table)
+    if block is not None:
+      offsets = [offsets[block]]
+    elif table != 'postprocessors':
+      offsets = offsets[-1:]
+
+    if len(offsets) == 1:
+      return dict(self.readBlock(offsets[0])[2])
+
+    data = {}
+    n_rows = 0
+    for offset in offsets:
+      columns = dict(self.readBlock(offset)[2])
+      length = max(len(values) for values in columns.values())
+
+      if n_rows > 0 and length > 0 and columns['time'][0] == data['time'][-1]:
+        n_rows -= 1
+        for values in data.values():
+          del values[-1]
+
+      for name, values in columns.items():
+        data.setdefault(name, [0.] * n_rows).extend(values)
+      for values in data.values():
+        values.extend([0.] * (n_rows + length - len(values)))
+      n_rows += length
+
+    return data
+
+  def _readIndex(self):
+    data = self._data
+    if len(data) < 12 + 16 or data[-8:] != TRAILER_MAGIC:
+      return None
+    (index_offset,) = self._unpack('Q', len(data) - 16)
+    if data[index_offset:index_offset + 4] != INDEX_MAGIC:
+      raise BinaryTableError('Corrupt block index')
+    (n_blocks,) = self._unpack('Q', index_offset + 4)
+    pos = index_offset + 12
+    blocks = []
+    for i in range(n_blocks):
+      offset, time = self._unpack('Qd', pos)
+      table, pos = self._readString(pos + 16)
+      blocks.append((offset, time, table))
+    return blocks
+
+  def _scanBlocks(self):
+    data = self._data
+    pos = 12
+    blocks = []
+    while pos < len(data):
+      if data[pos:pos + 4] == INDEX_MAGIC:
+        break
+      if data[pos:pos + 4] != BLOCK_MAGIC:
+        raise BinaryTableError('Corrupt block at offset %d' % pos)
+      table, end = self._readString(pos + 4)
+      time, compression, raw_size, stored_size = self._unpack('dBQQ', end)
+      end += struct.calcsize('=dBQQ') + stored_size
+      # The last block of a file that is being written may be incomplete
+      if end > len(data):
+        break
+      blocks.append((pos, time, table))
+      pos = end
+    return blocks
+
+  def _unpack(self, fmt, pos):
+    fmt = '=' + fmt
+    if pos + struct.calcsize(fmt) > len(self._data):
+      raise BinaryTableError('Unexpected end of file')
+    return struct.unpack_from(fmt, self._data, pos)
+
+  def _readString(self, pos):
+    (length,) = self._unpack('I', pos)
+    if pos + 4 + length > len(self._data):
+      raise BinaryTableError('Unexpected end of file')
+    return self._data[pos + 4:pos + 4 + length].decode(), pos + 4 + length
+
+def writeCSV(data, stream, names=None):
+  if names is None:
+    names = ['time', 'timestep'] + sorted(n for n in data if n not in ('time', 'timestep'))
+  for name in names:
+    if name not in data:
+      raise BinaryTableError('No column named %s' % name)
+  stream.write(','.join(names) + '\n')
+  n_rows = max(len(values) for values in data.values())
+  for i in range(n_rows):
+    stream.write(','.join(repr(data[n][i]) if i < len(data[n]) else '' for n in names) + '\n')
+
+if __name__ == '__main__':
+  parser = argparse.ArgumentParser(description="Read the files written by the BinaryTable output object")
+  parser.add_argument("filename", type = str, help="The BinaryTable (.mtab) file")
+  parser.add_argument("-t", "--table", type = str, help="The table to write as csv (lists the tables if omitted)")
+  parser.add_argument("-b", "--block", type = int, help="Only write this block of the table (negative numbers count from the end)")
+  parser.add_argument("-c", "--columns", type = str, nargs='+', help="Only write these columns (in this order)")
+  parser.add_argument("-o", "--output", type = str, help="Output csv file (defaults to stdout)")
+  args = parser.parse_args()
+
+  try:
+    table = BinaryTable(args.filename)
+    if args.table is None:
+      for name in table.tables():
+        print('%s (%d blocks)' % (name, len([b for b in table.blocks if b[2] == name])))
+    else:
+      data = table.read(args.table, args.block)
+      if args.output:
+        with open(args.output, 'w') as stream:
+          writeCSV(data, stream, args.columns)
+      else:
+        writeCSV(data, sys.stdout, args.columns)
+  except (IOError, BinaryTableError, struct.error, zlib.error) as e:
+    sys.stderr.write('%s\n' % e)
+    sys.exit(1)
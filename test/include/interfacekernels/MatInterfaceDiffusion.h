@@ -0,0 +1,42 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MATINTERFACEDIFFUSION_H
+#define MATINTERFACEDIFFUSION_H
+
+#include "InterfaceKernel.h"
+
+//Forward Declarations
+class MatInterfaceDiffusion;
+
+template<>
+InputParameters validParams<MatInterfaceDiffusion>();
+
+/**
+ * Interface diffusion with the diffusion coefficients of both sides taken from material properties
+ */
+class MatInterfaceDiffusion : public InterfaceKernel
+{
+public:
+  MatInterfaceDiffusion(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual(Moose::DGResidualType type);
+  virtual Real computeQpJacobian(Moose::DGJacobianType type);
+
+  const MaterialProperty<Real> & _D;
+  const MaterialProperty<Real> & _D_neighbor;
+};
+
+#endif
@@ -29,6 +29,9 @@ public:
   CoeffParamDiffusion(const InputParameters & parameters);
   virtual ~CoeffParamDiffusion();
 
+  /// computeQpResidual() is overridden, so the Diffusion batch residual does not apply
+  virtual bool supportsBatch() const override { return false; }
+
 protected:
 
   virtual Real computeQpResidual();
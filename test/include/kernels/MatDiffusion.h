@@ -36,6 +36,7 @@ protected:
 
   std::string _prop_name;
   const MaterialProperty<Real> * _diff;
+  const MaterialProperty<Real> * _jacobian_diff;
 };
 
 #endif //MATDIFFUSION_H
@@ -0,0 +1,51 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef JACOBIANONLYPROPERTYMATERIAL_H
+#define JACOBIANONLYPROPERTYMATERIAL_H
+
+#include "Material.h"
+
+class JacobianOnlyPropertyMaterial;
+
+template<>
+InputParameters validParams<JacobianOnlyPropertyMaterial>();
+
+/**
+ * JacobianOnlyPropertyMaterial declares a regular and a Jacobian-only
+ * property and errors if the Jacobian-only property has to be computed
+ * outside of a Jacobian evaluation.
+ */
+class JacobianOnlyPropertyMaterial : public Material
+{
+public:
+  JacobianOnlyPropertyMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+  /// The value of both properties
+  const Real _value;
+
+  /// The regular property
+  MaterialProperty<Real> & _prop;
+
+  /// The property only needed for the Jacobian
+  MaterialProperty<Real> & _jacobian_prop;
+
+  /// The id of the Jacobian-only property
+  const unsigned int _jacobian_prop_id;
+};
+
+#endif // JACOBIANONLYPROPERTYMATERIAL_H
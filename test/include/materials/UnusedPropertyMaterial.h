@@ -0,0 +1,42 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef UNUSEDPROPERTYMATERIAL_H
+#define UNUSEDPROPERTYMATERIAL_H
+
+#include "Material.h"
+
+class UnusedPropertyMaterial;
+
+template<>
+InputParameters validParams<UnusedPropertyMaterial>();
+
+/**
+ * UnusedPropertyMaterial errors out when it is computed, which makes it
+ * possible to test that materials whose properties are not consumed by
+ * the objects of a loop are skipped.
+ */
+class UnusedPropertyMaterial : public Material
+{
+public:
+  UnusedPropertyMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+  /// The property nobody is supposed to consume
+  MaterialProperty<Real> & _prop_value;
+};
+
+#endif // UNUSEDPROPERTYMATERIAL_H
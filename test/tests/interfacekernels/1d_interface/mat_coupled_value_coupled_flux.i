@@ -0,0 +1,131 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 10
+  xmax = 2
+[]
+
+[MeshModifiers]
+  [./subdomain1]
+    type = SubdomainBoundingBox
+    bottom_left = '1.0 0 0'
+    block_id = 1
+    top_right = '2.0 1.0 0'
+  [../]
+  [./interface]
+    type = SideSetsBetweenSubdomains
+    depends_on = subdomain1
+    master_block = '0'
+    paired_block = '1'
+    new_boundary = 'master0_interface'
+  [../]
+  [./interface_again]
+    type = SideSetsBetweenSubdomains
+    depends_on = subdomain1
+    master_block = '1'
+    paired_block = '0'
+    new_boundary = 'master1_interface'
+  [../]
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+    block = '0'
+  [../]
+
+
+  [./v]
+    order = FIRST
+    family = LAGRANGE
+    block = '1'
+  [../]
+[]
+
+[Kernels]
+  [./diff_u]
+    type = CoeffParamDiffusion
+    variable = u
+    D = 4
+    block = 0
+  [../]
+  [./diff_v]
+    type = CoeffParamDiffusion
+    variable = v
+    D = 2
+    block = 1
+  [../]
+[]
+
+[InterfaceKernels]
+  [./interface]
+    type = MatInterfaceDiffusion
+    variable = u
+    neighbor_var = v
+    boundary = master0_interface
+    D = D
+    D_neighbor = D
+  [../]
+[]
+
+# The diffusion coefficients are only used by the interface kernel, so they are
+# only computed if its material property dependencies are accounted for
+[Materials]
+  [./block0]
+    type = GenericConstantMaterial
+    block = 0
+    prop_names = 'D'
+    prop_values = '4'
+  [../]
+  [./block1]
+    type = GenericConstantMaterial
+    block = 1
+    prop_names = 'D'
+    prop_values = '2'
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = 'left'
+    value = 1
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = v
+    boundary = 'right'
+    value = 0
+  [../]
+  [./middle]
+    type = MatchedValueBC
+    variable = v
+    boundary = 'master0_interface'
+    v = u
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  # Same solution as coupled_value_coupled_flux.i, compared against its gold file
+  file_base = coupled_value_coupled_flux_out
+  exodus = true
+  print_linear_residuals = true
+[]
+
+[Debug]
+  show_var_residual_norms = true
+[]
@@ -0,0 +1,52 @@
+# The 'diffusivity' material errors if its Jacobian-only property is computed
+# outside of the Jacobian. The kernel only retrieves that property for its
+# Jacobian, so the residual evaluations must skip it.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = MatDiffusion
+    variable = u
+    prop_name = diffusivity
+    jacobian_prop_name = jacobian_diffusivity
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Materials]
+  [./diffusivity]
+    type = JacobianOnlyPropertyMaterial
+    prop_name = diffusivity
+    jacobian_prop_name = jacobian_diffusivity
+    value = 2
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
@@ -0,0 +1,83 @@
+# The 'unused' material errors if it is computed. None of the kernels, BCs,
+# aux kernels or postprocessors consume its property, so it must be skipped.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./diffusivity]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = MatDiffusion
+    variable = u
+    prop_name = diffusivity
+  [../]
+[]
+
+[AuxKernels]
+  [./diffusivity]
+    type = MaterialRealAux
+    variable = diffusivity
+    property = diffusivity
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Materials]
+  [./scale]
+    type = GenericConstantMaterial
+    prop_names = 'scale'
+    prop_values = '2' # diffusivity = 4 / scale
+  [../]
+  [./diffusivity]
+    type = CoupledMaterial
+    mat_prop = diffusivity
+    coupled_mat_prop = scale
+  [../]
+  [./unused]
+    type = UnusedPropertyMaterial
+  [../]
+[]
+
+[Postprocessors]
+  [./average_diffusivity]
+    type = ElementAverageValue
+    variable = diffusivity
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  csv = true
+[]
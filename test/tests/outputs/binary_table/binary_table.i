@@ -0,0 +1,88 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./aux0]
+    order = SECOND
+    family = SCALAR
+  [../]
+  [./aux1]
+    family = SCALAR
+    initial_condition = 5
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = CoefDiffusion
+    variable = u
+    coef = 0.1
+  [../]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./mid_point]
+    type = PointValue
+    variable = u
+    point = '0.5 0.5 0'
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./line]
+    type = LineValueSampler
+    variable = u
+    start_point = '0 0.5 0'
+    end_point = '1 0.5 0'
+    num_points = 11
+    sort_by = x
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 10
+  dt = 0.1
+  solve_type = PJFNK
+[]
+
+[Outputs]
+  [./binary]
+    type = BinaryTable
+    file_base = binary_table_out
+    rows_per_block = 4
+  [../]
+  # The same history as CSV files to compare the output of the reader with
+  [./csv]
+    type = CSV
+    file_base = csv/binary_table_out
+  [../]
+[]
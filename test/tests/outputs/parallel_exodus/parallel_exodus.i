@@ -0,0 +1,76 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./pid]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./pid]
+    type = ProcessorIDAux
+    variable = pid
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./average]
+    type = ElementAverageValue
+    variable = u
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 0.1
+  solve_type = PJFNK
+[]
+
+[Outputs]
+  [./out]
+    type = ParallelExodus
+  [../]
+  # The same output from the Exodus writer to compare with
+  [./exodus]
+    type = Exodus
+    file_base = exodus/parallel_exodus_out
+  [../]
+[]
@@ -0,0 +1,88 @@
+# Each sub app has nodes at x = 0, 1, 2.  With the sub apps placed at x = 0
+# and x = 3 the master nodes at x = 0.5 and 3.5 are equidistant to two nodes
+# of the same sub app and the master node at x = 2.5 is equidistant to a node
+# of each sub app.  Ties go to the first node found: the lowest node of the
+# sub app for ties within an app and the first sub app for ties across apps.
+# The sub app values are different at every node and change in time so the
+# transfer has to pick the same nodes again when it reuses its cache.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 10
+  xmax = 5
+[]
+
+[AuxVariables]
+  [./from_sub]
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Postprocessors]
+  [./within_tie_a]
+    type = PointValue
+    variable = from_sub
+    point = '0.5 0 0'
+    execute_on = 'initial timestep_end'
+  [../]
+  [./exact_a]
+    type = PointValue
+    variable = from_sub
+    point = '1 0 0'
+    execute_on = 'initial timestep_end'
+  [../]
+  [./across_tie]
+    type = PointValue
+    variable = from_sub
+    point = '2.5 0 0'
+    execute_on = 'initial timestep_end'
+  [../]
+  [./within_tie_b]
+    type = PointValue
+    variable = from_sub
+    point = '3.5 0 0'
+    execute_on = 'initial timestep_end'
+  [../]
+  [./exact_b]
+    type = PointValue
+    variable = from_sub
+    point = '4 0 0'
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+[]
+
+[Outputs]
+  csv = true
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    positions = '0 0 0
+                 3 0 0'
+    input_files = 'fromsub_ties_sub0.i fromsub_ties_sub1.i'
+    execute_on = timestep_begin
+  [../]
+[]
+
+[Transfers]
+  [./from_sub]
+    type = MultiAppNearestNodeTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = from_sub
+    fixed_meshes = true
+    execute_on = timestep_begin
+  [../]
+[]
@@ -0,0 +1,37 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 2
+  xmax = 2
+[]
+
+[AuxVariables]
+  [./u]
+  [../]
+[]
+
+[Functions]
+  [./u_fun]
+    type = ParsedFunction
+    value = 10+x+t
+  [../]
+[]
+
+[AuxKernels]
+  [./u_kern]
+    type = FunctionAux
+    variable = u
+    function = u_fun
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+[]
@@ -36,6 +36,9 @@ public:
   DarcyPressure(const InputParameters & parameters);
   virtual ~DarcyPressure();
 
+  /// computeQpResidual() is overridden, so the Diffusion batch residual does not apply
+  virtual bool supportsBatch() const override { return false; }
+
 protected:
   /**
    * Kernels _must_ override computeQpResidual()
@@ -0,0 +1,37 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef FORMATTEDTABLETEST_H
+#define FORMATTEDTABLETEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class FormattedTableTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE(FormattedTableTest);
+  CPPUNIT_TEST(appendRows);
+  CPPUNIT_TEST(rewriteOnChange);
+  CPPUNIT_TEST(appendWithInterval);
+  CPPUNIT_TEST(appendAligned);
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void appendRows();
+  void rewriteOnChange();
+  void appendWithInterval();
+  void appendAligned();
+};
+
+#endif  // FORMATTEDTABLETEST_H
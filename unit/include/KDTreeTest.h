@@ -0,0 +1,37 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+#ifndef KDTREETEST_H
+#define KDTREETEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class KDTreeTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( KDTreeTest );
+
+  CPPUNIT_TEST( neighborSearchTest );
+  CPPUNIT_TEST( bruteForceTest );
+  CPPUNIT_TEST( smallTreeTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void neighborSearchTest();
+  void bruteForceTest();
+  void smallTreeTest();
+};
+
+#endif  // KDTREETEST_H